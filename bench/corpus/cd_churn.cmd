@@ -0,0 +1,25 @@
+:: Changing directories relative, absolute and through "..", with %CD% expanded between moves.
+cd dir00
+cd sub0
+cd ..
+cd ..\dir01\sub1
+cd ..\..
+cd C:\corpus\dir02
+echo %CD%
+cd \
+cd corpus
+cd dir03\sub2
+echo %CD%
+cd C:\corpus
+for %a in (dir00 dir01 dir02 dir03 dir04 dir05 dir06 dir07) do (
+    cd %a
+    cd sub3
+    echo %CD%
+    cd ..\..
+)
+for %a in (dir08 dir09 dir10 dir11 dir12 dir13 dir14 dir15) do for %b in (sub0 sub1 sub2 sub3) do cd C:\corpus\%a\%b
+cd C:\corpus
+for %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20) do cd dir05 & cd sub1 & cd ..\.. & cd
+cd nosuchdir
+cd C:\corpus\dir06\nosuchdir
+cd
@@ -0,0 +1,1308 @@
+:: SETLOCAL nested 1000 deep over 300 variables, with a SET at every level, then unwound by a
+:: FOR loop of ENDLOCALs. Each scope saves and restores the whole environment, so this shows
+:: whether that cost grows with the number of variables or with the depth.
+setlocal
+set DEEP_VAR_000=value 0 of the deep scope corpus
+set DEEP_VAR_001=value 1 of the deep scope corpus
+set DEEP_VAR_002=value 2 of the deep scope corpus
+set DEEP_VAR_003=value 3 of the deep scope corpus
+set DEEP_VAR_004=value 4 of the deep scope corpus
+set DEEP_VAR_005=value 5 of the deep scope corpus
+set DEEP_VAR_006=value 6 of the deep scope corpus
+set DEEP_VAR_007=value 7 of the deep scope corpus
+set DEEP_VAR_008=value 8 of the deep scope corpus
+set DEEP_VAR_009=value 9 of the deep scope corpus
+set DEEP_VAR_010=value 10 of the deep scope corpus
+set DEEP_VAR_011=value 11 of the deep scope corpus
+set DEEP_VAR_012=value 12 of the deep scope corpus
+set DEEP_VAR_013=value 13 of the deep scope corpus
+set DEEP_VAR_014=value 14 of the deep scope corpus
+set DEEP_VAR_015=value 15 of the deep scope corpus
+set DEEP_VAR_016=value 16 of the deep scope corpus
+set DEEP_VAR_017=value 17 of the deep scope corpus
+set DEEP_VAR_018=value 18 of the deep scope corpus
+set DEEP_VAR_019=value 19 of the deep scope corpus
+set DEEP_VAR_020=value 20 of the deep scope corpus
+set DEEP_VAR_021=value 21 of the deep scope corpus
+set DEEP_VAR_022=value 22 of the deep scope corpus
+set DEEP_VAR_023=value 23 of the deep scope corpus
+set DEEP_VAR_024=value 24 of the deep scope corpus
+set DEEP_VAR_025=value 25 of the deep scope corpus
+set DEEP_VAR_026=value 26 of the deep scope corpus
+set DEEP_VAR_027=value 27 of the deep scope corpus
+set DEEP_VAR_028=value 28 of the deep scope corpus
+set DEEP_VAR_029=value 29 of the deep scope corpus
+set DEEP_VAR_030=value 30 of the deep scope corpus
+set DEEP_VAR_031=value 31 of the deep scope corpus
+set DEEP_VAR_032=value 32 of the deep scope corpus
+set DEEP_VAR_033=value 33 of the deep scope corpus
+set DEEP_VAR_034=value 34 of the deep scope corpus
+set DEEP_VAR_035=value 35 of the deep scope corpus
+set DEEP_VAR_036=value 36 of the deep scope corpus
+set DEEP_VAR_037=value 37 of the deep scope corpus
+set DEEP_VAR_038=value 38 of the deep scope corpus
+set DEEP_VAR_039=value 39 of the deep scope corpus
+set DEEP_VAR_040=value 40 of the deep scope corpus
+set DEEP_VAR_041=value 41 of the deep scope corpus
+set DEEP_VAR_042=value 42 of the deep scope corpus
+set DEEP_VAR_043=value 43 of the deep scope corpus
+set DEEP_VAR_044=value 44 of the deep scope corpus
+set DEEP_VAR_045=value 45 of the deep scope corpus
+set DEEP_VAR_046=value 46 of the deep scope corpus
+set DEEP_VAR_047=value 47 of the deep scope corpus
+set DEEP_VAR_048=value 48 of the deep scope corpus
+set DEEP_VAR_049=value 49 of the deep scope corpus
+set DEEP_VAR_050=value 50 of the deep scope corpus
+set DEEP_VAR_051=value 51 of the deep scope corpus
+set DEEP_VAR_052=value 52 of the deep scope corpus
+set DEEP_VAR_053=value 53 of the deep scope corpus
+set DEEP_VAR_054=value 54 of the deep scope corpus
+set DEEP_VAR_055=value 55 of the deep scope corpus
+set DEEP_VAR_056=value 56 of the deep scope corpus
+set DEEP_VAR_057=value 57 of the deep scope corpus
+set DEEP_VAR_058=value 58 of the deep scope corpus
+set DEEP_VAR_059=value 59 of the deep scope corpus
+set DEEP_VAR_060=value 60 of the deep scope corpus
+set DEEP_VAR_061=value 61 of the deep scope corpus
+set DEEP_VAR_062=value 62 of the deep scope corpus
+set DEEP_VAR_063=value 63 of the deep scope corpus
+set DEEP_VAR_064=value 64 of the deep scope corpus
+set DEEP_VAR_065=value 65 of the deep scope corpus
+set DEEP_VAR_066=value 66 of the deep scope corpus
+set DEEP_VAR_067=value 67 of the deep scope corpus
+set DEEP_VAR_068=value 68 of the deep scope corpus
+set DEEP_VAR_069=value 69 of the deep scope corpus
+set DEEP_VAR_070=value 70 of the deep scope corpus
+set DEEP_VAR_071=value 71 of the deep scope corpus
+set DEEP_VAR_072=value 72 of the deep scope corpus
+set DEEP_VAR_073=value 73 of the deep scope corpus
+set DEEP_VAR_074=value 74 of the deep scope corpus
+set DEEP_VAR_075=value 75 of the deep scope corpus
+set DEEP_VAR_076=value 76 of the deep scope corpus
+set DEEP_VAR_077=value 77 of the deep scope corpus
+set DEEP_VAR_078=value 78 of the deep scope corpus
+set DEEP_VAR_079=value 79 of the deep scope corpus
+set DEEP_VAR_080=value 80 of the deep scope corpus
+set DEEP_VAR_081=value 81 of the deep scope corpus
+set DEEP_VAR_082=value 82 of the deep scope corpus
+set DEEP_VAR_083=value 83 of the deep scope corpus
+set DEEP_VAR_084=value 84 of the deep scope corpus
+set DEEP_VAR_085=value 85 of the deep scope corpus
+set DEEP_VAR_086=value 86 of the deep scope corpus
+set DEEP_VAR_087=value 87 of the deep scope corpus
+set DEEP_VAR_088=value 88 of the deep scope corpus
+set DEEP_VAR_089=value 89 of the deep scope corpus
+set DEEP_VAR_090=value 90 of the deep scope corpus
+set DEEP_VAR_091=value 91 of the deep scope corpus
+set DEEP_VAR_092=value 92 of the deep scope corpus
+set DEEP_VAR_093=value 93 of the deep scope corpus
+set DEEP_VAR_094=value 94 of the deep scope corpus
+set DEEP_VAR_095=value 95 of the deep scope corpus
+set DEEP_VAR_096=value 96 of the deep scope corpus
+set DEEP_VAR_097=value 97 of the deep scope corpus
+set DEEP_VAR_098=value 98 of the deep scope corpus
+set DEEP_VAR_099=value 99 of the deep scope corpus
+set DEEP_VAR_100=value 100 of the deep scope corpus
+set DEEP_VAR_101=value 101 of the deep scope corpus
+set DEEP_VAR_102=value 102 of the deep scope corpus
+set DEEP_VAR_103=value 103 of the deep scope corpus
+set DEEP_VAR_104=value 104 of the deep scope corpus
+set DEEP_VAR_105=value 105 of the deep scope corpus
+set DEEP_VAR_106=value 106 of the deep scope corpus
+set DEEP_VAR_107=value 107 of the deep scope corpus
+set DEEP_VAR_108=value 108 of the deep scope corpus
+set DEEP_VAR_109=value 109 of the deep scope corpus
+set DEEP_VAR_110=value 110 of the deep scope corpus
+set DEEP_VAR_111=value 111 of the deep scope corpus
+set DEEP_VAR_112=value 112 of the deep scope corpus
+set DEEP_VAR_113=value 113 of the deep scope corpus
+set DEEP_VAR_114=value 114 of the deep scope corpus
+set DEEP_VAR_115=value 115 of the deep scope corpus
+set DEEP_VAR_116=value 116 of the deep scope corpus
+set DEEP_VAR_117=value 117 of the deep scope corpus
+set DEEP_VAR_118=value 118 of the deep scope corpus
+set DEEP_VAR_119=value 119 of the deep scope corpus
+set DEEP_VAR_120=value 120 of the deep scope corpus
+set DEEP_VAR_121=value 121 of the deep scope corpus
+set DEEP_VAR_122=value 122 of the deep scope corpus
+set DEEP_VAR_123=value 123 of the deep scope corpus
+set DEEP_VAR_124=value 124 of the deep scope corpus
+set DEEP_VAR_125=value 125 of the deep scope corpus
+set DEEP_VAR_126=value 126 of the deep scope corpus
+set DEEP_VAR_127=value 127 of the deep scope corpus
+set DEEP_VAR_128=value 128 of the deep scope corpus
+set DEEP_VAR_129=value 129 of the deep scope corpus
+set DEEP_VAR_130=value 130 of the deep scope corpus
+set DEEP_VAR_131=value 131 of the deep scope corpus
+set DEEP_VAR_132=value 132 of the deep scope corpus
+set DEEP_VAR_133=value 133 of the deep scope corpus
+set DEEP_VAR_134=value 134 of the deep scope corpus
+set DEEP_VAR_135=value 135 of the deep scope corpus
+set DEEP_VAR_136=value 136 of the deep scope corpus
+set DEEP_VAR_137=value 137 of the deep scope corpus
+set DEEP_VAR_138=value 138 of the deep scope corpus
+set DEEP_VAR_139=value 139 of the deep scope corpus
+set DEEP_VAR_140=value 140 of the deep scope corpus
+set DEEP_VAR_141=value 141 of the deep scope corpus
+set DEEP_VAR_142=value 142 of the deep scope corpus
+set DEEP_VAR_143=value 143 of the deep scope corpus
+set DEEP_VAR_144=value 144 of the deep scope corpus
+set DEEP_VAR_145=value 145 of the deep scope corpus
+set DEEP_VAR_146=value 146 of the deep scope corpus
+set DEEP_VAR_147=value 147 of the deep scope corpus
+set DEEP_VAR_148=value 148 of the deep scope corpus
+set DEEP_VAR_149=value 149 of the deep scope corpus
+set DEEP_VAR_150=value 150 of the deep scope corpus
+set DEEP_VAR_151=value 151 of the deep scope corpus
+set DEEP_VAR_152=value 152 of the deep scope corpus
+set DEEP_VAR_153=value 153 of the deep scope corpus
+set DEEP_VAR_154=value 154 of the deep scope corpus
+set DEEP_VAR_155=value 155 of the deep scope corpus
+set DEEP_VAR_156=value 156 of the deep scope corpus
+set DEEP_VAR_157=value 157 of the deep scope corpus
+set DEEP_VAR_158=value 158 of the deep scope corpus
+set DEEP_VAR_159=value 159 of the deep scope corpus
+set DEEP_VAR_160=value 160 of the deep scope corpus
+set DEEP_VAR_161=value 161 of the deep scope corpus
+set DEEP_VAR_162=value 162 of the deep scope corpus
+set DEEP_VAR_163=value 163 of the deep scope corpus
+set DEEP_VAR_164=value 164 of the deep scope corpus
+set DEEP_VAR_165=value 165 of the deep scope corpus
+set DEEP_VAR_166=value 166 of the deep scope corpus
+set DEEP_VAR_167=value 167 of the deep scope corpus
+set DEEP_VAR_168=value 168 of the deep scope corpus
+set DEEP_VAR_169=value 169 of the deep scope corpus
+set DEEP_VAR_170=value 170 of the deep scope corpus
+set DEEP_VAR_171=value 171 of the deep scope corpus
+set DEEP_VAR_172=value 172 of the deep scope corpus
+set DEEP_VAR_173=value 173 of the deep scope corpus
+set DEEP_VAR_174=value 174 of the deep scope corpus
+set DEEP_VAR_175=value 175 of the deep scope corpus
+set DEEP_VAR_176=value 176 of the deep scope corpus
+set DEEP_VAR_177=value 177 of the deep scope corpus
+set DEEP_VAR_178=value 178 of the deep scope corpus
+set DEEP_VAR_179=value 179 of the deep scope corpus
+set DEEP_VAR_180=value 180 of the deep scope corpus
+set DEEP_VAR_181=value 181 of the deep scope corpus
+set DEEP_VAR_182=value 182 of the deep scope corpus
+set DEEP_VAR_183=value 183 of the deep scope corpus
+set DEEP_VAR_184=value 184 of the deep scope corpus
+set DEEP_VAR_185=value 185 of the deep scope corpus
+set DEEP_VAR_186=value 186 of the deep scope corpus
+set DEEP_VAR_187=value 187 of the deep scope corpus
+set DEEP_VAR_188=value 188 of the deep scope corpus
+set DEEP_VAR_189=value 189 of the deep scope corpus
+set DEEP_VAR_190=value 190 of the deep scope corpus
+set DEEP_VAR_191=value 191 of the deep scope corpus
+set DEEP_VAR_192=value 192 of the deep scope corpus
+set DEEP_VAR_193=value 193 of the deep scope corpus
+set DEEP_VAR_194=value 194 of the deep scope corpus
+set DEEP_VAR_195=value 195 of the deep scope corpus
+set DEEP_VAR_196=value 196 of the deep scope corpus
+set DEEP_VAR_197=value 197 of the deep scope corpus
+set DEEP_VAR_198=value 198 of the deep scope corpus
+set DEEP_VAR_199=value 199 of the deep scope corpus
+set DEEP_VAR_200=value 200 of the deep scope corpus
+set DEEP_VAR_201=value 201 of the deep scope corpus
+set DEEP_VAR_202=value 202 of the deep scope corpus
+set DEEP_VAR_203=value 203 of the deep scope corpus
+set DEEP_VAR_204=value 204 of the deep scope corpus
+set DEEP_VAR_205=value 205 of the deep scope corpus
+set DEEP_VAR_206=value 206 of the deep scope corpus
+set DEEP_VAR_207=value 207 of the deep scope corpus
+set DEEP_VAR_208=value 208 of the deep scope corpus
+set DEEP_VAR_209=value 209 of the deep scope corpus
+set DEEP_VAR_210=value 210 of the deep scope corpus
+set DEEP_VAR_211=value 211 of the deep scope corpus
+set DEEP_VAR_212=value 212 of the deep scope corpus
+set DEEP_VAR_213=value 213 of the deep scope corpus
+set DEEP_VAR_214=value 214 of the deep scope corpus
+set DEEP_VAR_215=value 215 of the deep scope corpus
+set DEEP_VAR_216=value 216 of the deep scope corpus
+set DEEP_VAR_217=value 217 of the deep scope corpus
+set DEEP_VAR_218=value 218 of the deep scope corpus
+set DEEP_VAR_219=value 219 of the deep scope corpus
+set DEEP_VAR_220=value 220 of the deep scope corpus
+set DEEP_VAR_221=value 221 of the deep scope corpus
+set DEEP_VAR_222=value 222 of the deep scope corpus
+set DEEP_VAR_223=value 223 of the deep scope corpus
+set DEEP_VAR_224=value 224 of the deep scope corpus
+set DEEP_VAR_225=value 225 of the deep scope corpus
+set DEEP_VAR_226=value 226 of the deep scope corpus
+set DEEP_VAR_227=value 227 of the deep scope corpus
+set DEEP_VAR_228=value 228 of the deep scope corpus
+set DEEP_VAR_229=value 229 of the deep scope corpus
+set DEEP_VAR_230=value 230 of the deep scope corpus
+set DEEP_VAR_231=value 231 of the deep scope corpus
+set DEEP_VAR_232=value 232 of the deep scope corpus
+set DEEP_VAR_233=value 233 of the deep scope corpus
+set DEEP_VAR_234=value 234 of the deep scope corpus
+set DEEP_VAR_235=value 235 of the deep scope corpus
+set DEEP_VAR_236=value 236 of the deep scope corpus
+set DEEP_VAR_237=value 237 of the deep scope corpus
+set DEEP_VAR_238=value 238 of the deep scope corpus
+set DEEP_VAR_239=value 239 of the deep scope corpus
+set DEEP_VAR_240=value 240 of the deep scope corpus
+set DEEP_VAR_241=value 241 of the deep scope corpus
+set DEEP_VAR_242=value 242 of the deep scope corpus
+set DEEP_VAR_243=value 243 of the deep scope corpus
+set DEEP_VAR_244=value 244 of the deep scope corpus
+set DEEP_VAR_245=value 245 of the deep scope corpus
+set DEEP_VAR_246=value 246 of the deep scope corpus
+set DEEP_VAR_247=value 247 of the deep scope corpus
+set DEEP_VAR_248=value 248 of the deep scope corpus
+set DEEP_VAR_249=value 249 of the deep scope corpus
+set DEEP_VAR_250=value 250 of the deep scope corpus
+set DEEP_VAR_251=value 251 of the deep scope corpus
+set DEEP_VAR_252=value 252 of the deep scope corpus
+set DEEP_VAR_253=value 253 of the deep scope corpus
+set DEEP_VAR_254=value 254 of the deep scope corpus
+set DEEP_VAR_255=value 255 of the deep scope corpus
+set DEEP_VAR_256=value 256 of the deep scope corpus
+set DEEP_VAR_257=value 257 of the deep scope corpus
+set DEEP_VAR_258=value 258 of the deep scope corpus
+set DEEP_VAR_259=value 259 of the deep scope corpus
+set DEEP_VAR_260=value 260 of the deep scope corpus
+set DEEP_VAR_261=value 261 of the deep scope corpus
+set DEEP_VAR_262=value 262 of the deep scope corpus
+set DEEP_VAR_263=value 263 of the deep scope corpus
+set DEEP_VAR_264=value 264 of the deep scope corpus
+set DEEP_VAR_265=value 265 of the deep scope corpus
+set DEEP_VAR_266=value 266 of the deep scope corpus
+set DEEP_VAR_267=value 267 of the deep scope corpus
+set DEEP_VAR_268=value 268 of the deep scope corpus
+set DEEP_VAR_269=value 269 of the deep scope corpus
+set DEEP_VAR_270=value 270 of the deep scope corpus
+set DEEP_VAR_271=value 271 of the deep scope corpus
+set DEEP_VAR_272=value 272 of the deep scope corpus
+set DEEP_VAR_273=value 273 of the deep scope corpus
+set DEEP_VAR_274=value 274 of the deep scope corpus
+set DEEP_VAR_275=value 275 of the deep scope corpus
+set DEEP_VAR_276=value 276 of the deep scope corpus
+set DEEP_VAR_277=value 277 of the deep scope corpus
+set DEEP_VAR_278=value 278 of the deep scope corpus
+set DEEP_VAR_279=value 279 of the deep scope corpus
+set DEEP_VAR_280=value 280 of the deep scope corpus
+set DEEP_VAR_281=value 281 of the deep scope corpus
+set DEEP_VAR_282=value 282 of the deep scope corpus
+set DEEP_VAR_283=value 283 of the deep scope corpus
+set DEEP_VAR_284=value 284 of the deep scope corpus
+set DEEP_VAR_285=value 285 of the deep scope corpus
+set DEEP_VAR_286=value 286 of the deep scope corpus
+set DEEP_VAR_287=value 287 of the deep scope corpus
+set DEEP_VAR_288=value 288 of the deep scope corpus
+set DEEP_VAR_289=value 289 of the deep scope corpus
+set DEEP_VAR_290=value 290 of the deep scope corpus
+set DEEP_VAR_291=value 291 of the deep scope corpus
+set DEEP_VAR_292=value 292 of the deep scope corpus
+set DEEP_VAR_293=value 293 of the deep scope corpus
+set DEEP_VAR_294=value 294 of the deep scope corpus
+set DEEP_VAR_295=value 295 of the deep scope corpus
+set DEEP_VAR_296=value 296 of the deep scope corpus
+set DEEP_VAR_297=value 297 of the deep scope corpus
+set DEEP_VAR_298=value 298 of the deep scope corpus
+set DEEP_VAR_299=value 299 of the deep scope corpus
+setlocal & set DEPTH=1& set DEEP_VAR_001=changed at depth 1
+setlocal & set DEPTH=2& set DEEP_VAR_002=changed at depth 2
+setlocal & set DEPTH=3& set DEEP_VAR_003=changed at depth 3
+setlocal & set DEPTH=4& set DEEP_VAR_004=changed at depth 4
+setlocal & set DEPTH=5& set DEEP_VAR_005=changed at depth 5
+setlocal & set DEPTH=6& set DEEP_VAR_006=changed at depth 6
+setlocal & set DEPTH=7& set DEEP_VAR_007=changed at depth 7
+setlocal & set DEPTH=8& set DEEP_VAR_008=changed at depth 8
+setlocal & set DEPTH=9& set DEEP_VAR_009=changed at depth 9
+setlocal & set DEPTH=10& set DEEP_VAR_010=changed at depth 10
+setlocal & set DEPTH=11& set DEEP_VAR_011=changed at depth 11
+setlocal & set DEPTH=12& set DEEP_VAR_012=changed at depth 12
+setlocal & set DEPTH=13& set DEEP_VAR_013=changed at depth 13
+setlocal & set DEPTH=14& set DEEP_VAR_014=changed at depth 14
+setlocal & set DEPTH=15& set DEEP_VAR_015=changed at depth 15
+setlocal & set DEPTH=16& set DEEP_VAR_016=changed at depth 16
+setlocal & set DEPTH=17& set DEEP_VAR_017=changed at depth 17
+setlocal & set DEPTH=18& set DEEP_VAR_018=changed at depth 18
+setlocal & set DEPTH=19& set DEEP_VAR_019=changed at depth 19
+setlocal & set DEPTH=20& set DEEP_VAR_020=changed at depth 20
+setlocal & set DEPTH=21& set DEEP_VAR_021=changed at depth 21
+setlocal & set DEPTH=22& set DEEP_VAR_022=changed at depth 22
+setlocal & set DEPTH=23& set DEEP_VAR_023=changed at depth 23
+setlocal & set DEPTH=24& set DEEP_VAR_024=changed at depth 24
+setlocal & set DEPTH=25& set DEEP_VAR_025=changed at depth 25
+setlocal & set DEPTH=26& set DEEP_VAR_026=changed at depth 26
+setlocal & set DEPTH=27& set DEEP_VAR_027=changed at depth 27
+setlocal & set DEPTH=28& set DEEP_VAR_028=changed at depth 28
+setlocal & set DEPTH=29& set DEEP_VAR_029=changed at depth 29
+setlocal & set DEPTH=30& set DEEP_VAR_030=changed at depth 30
+setlocal & set DEPTH=31& set DEEP_VAR_031=changed at depth 31
+setlocal & set DEPTH=32& set DEEP_VAR_032=changed at depth 32
+setlocal & set DEPTH=33& set DEEP_VAR_033=changed at depth 33
+setlocal & set DEPTH=34& set DEEP_VAR_034=changed at depth 34
+setlocal & set DEPTH=35& set DEEP_VAR_035=changed at depth 35
+setlocal & set DEPTH=36& set DEEP_VAR_036=changed at depth 36
+setlocal & set DEPTH=37& set DEEP_VAR_037=changed at depth 37
+setlocal & set DEPTH=38& set DEEP_VAR_038=changed at depth 38
+setlocal & set DEPTH=39& set DEEP_VAR_039=changed at depth 39
+setlocal & set DEPTH=40& set DEEP_VAR_040=changed at depth 40
+setlocal & set DEPTH=41& set DEEP_VAR_041=changed at depth 41
+setlocal & set DEPTH=42& set DEEP_VAR_042=changed at depth 42
+setlocal & set DEPTH=43& set DEEP_VAR_043=changed at depth 43
+setlocal & set DEPTH=44& set DEEP_VAR_044=changed at depth 44
+setlocal & set DEPTH=45& set DEEP_VAR_045=changed at depth 45
+setlocal & set DEPTH=46& set DEEP_VAR_046=changed at depth 46
+setlocal & set DEPTH=47& set DEEP_VAR_047=changed at depth 47
+setlocal & set DEPTH=48& set DEEP_VAR_048=changed at depth 48
+setlocal & set DEPTH=49& set DEEP_VAR_049=changed at depth 49
+setlocal & set DEPTH=50& set DEEP_VAR_050=changed at depth 50
+setlocal & set DEPTH=51& set DEEP_VAR_051=changed at depth 51
+setlocal & set DEPTH=52& set DEEP_VAR_052=changed at depth 52
+setlocal & set DEPTH=53& set DEEP_VAR_053=changed at depth 53
+setlocal & set DEPTH=54& set DEEP_VAR_054=changed at depth 54
+setlocal & set DEPTH=55& set DEEP_VAR_055=changed at depth 55
+setlocal & set DEPTH=56& set DEEP_VAR_056=changed at depth 56
+setlocal & set DEPTH=57& set DEEP_VAR_057=changed at depth 57
+setlocal & set DEPTH=58& set DEEP_VAR_058=changed at depth 58
+setlocal & set DEPTH=59& set DEEP_VAR_059=changed at depth 59
+setlocal & set DEPTH=60& set DEEP_VAR_060=changed at depth 60
+setlocal & set DEPTH=61& set DEEP_VAR_061=changed at depth 61
+setlocal & set DEPTH=62& set DEEP_VAR_062=changed at depth 62
+setlocal & set DEPTH=63& set DEEP_VAR_063=changed at depth 63
+setlocal & set DEPTH=64& set DEEP_VAR_064=changed at depth 64
+setlocal & set DEPTH=65& set DEEP_VAR_065=changed at depth 65
+setlocal & set DEPTH=66& set DEEP_VAR_066=changed at depth 66
+setlocal & set DEPTH=67& set DEEP_VAR_067=changed at depth 67
+setlocal & set DEPTH=68& set DEEP_VAR_068=changed at depth 68
+setlocal & set DEPTH=69& set DEEP_VAR_069=changed at depth 69
+setlocal & set DEPTH=70& set DEEP_VAR_070=changed at depth 70
+setlocal & set DEPTH=71& set DEEP_VAR_071=changed at depth 71
+setlocal & set DEPTH=72& set DEEP_VAR_072=changed at depth 72
+setlocal & set DEPTH=73& set DEEP_VAR_073=changed at depth 73
+setlocal & set DEPTH=74& set DEEP_VAR_074=changed at depth 74
+setlocal & set DEPTH=75& set DEEP_VAR_075=changed at depth 75
+setlocal & set DEPTH=76& set DEEP_VAR_076=changed at depth 76
+setlocal & set DEPTH=77& set DEEP_VAR_077=changed at depth 77
+setlocal & set DEPTH=78& set DEEP_VAR_078=changed at depth 78
+setlocal & set DEPTH=79& set DEEP_VAR_079=changed at depth 79
+setlocal & set DEPTH=80& set DEEP_VAR_080=changed at depth 80
+setlocal & set DEPTH=81& set DEEP_VAR_081=changed at depth 81
+setlocal & set DEPTH=82& set DEEP_VAR_082=changed at depth 82
+setlocal & set DEPTH=83& set DEEP_VAR_083=changed at depth 83
+setlocal & set DEPTH=84& set DEEP_VAR_084=changed at depth 84
+setlocal & set DEPTH=85& set DEEP_VAR_085=changed at depth 85
+setlocal & set DEPTH=86& set DEEP_VAR_086=changed at depth 86
+setlocal & set DEPTH=87& set DEEP_VAR_087=changed at depth 87
+setlocal & set DEPTH=88& set DEEP_VAR_088=changed at depth 88
+setlocal & set DEPTH=89& set DEEP_VAR_089=changed at depth 89
+setlocal & set DEPTH=90& set DEEP_VAR_090=changed at depth 90
+setlocal & set DEPTH=91& set DEEP_VAR_091=changed at depth 91
+setlocal & set DEPTH=92& set DEEP_VAR_092=changed at depth 92
+setlocal & set DEPTH=93& set DEEP_VAR_093=changed at depth 93
+setlocal & set DEPTH=94& set DEEP_VAR_094=changed at depth 94
+setlocal & set DEPTH=95& set DEEP_VAR_095=changed at depth 95
+setlocal & set DEPTH=96& set DEEP_VAR_096=changed at depth 96
+setlocal & set DEPTH=97& set DEEP_VAR_097=changed at depth 97
+setlocal & set DEPTH=98& set DEEP_VAR_098=changed at depth 98
+setlocal & set DEPTH=99& set DEEP_VAR_099=changed at depth 99
+setlocal & set DEPTH=100& set DEEP_VAR_100=changed at depth 100
+setlocal & set DEPTH=101& set DEEP_VAR_101=changed at depth 101
+setlocal & set DEPTH=102& set DEEP_VAR_102=changed at depth 102
+setlocal & set DEPTH=103& set DEEP_VAR_103=changed at depth 103
+setlocal & set DEPTH=104& set DEEP_VAR_104=changed at depth 104
+setlocal & set DEPTH=105& set DEEP_VAR_105=changed at depth 105
+setlocal & set DEPTH=106& set DEEP_VAR_106=changed at depth 106
+setlocal & set DEPTH=107& set DEEP_VAR_107=changed at depth 107
+setlocal & set DEPTH=108& set DEEP_VAR_108=changed at depth 108
+setlocal & set DEPTH=109& set DEEP_VAR_109=changed at depth 109
+setlocal & set DEPTH=110& set DEEP_VAR_110=changed at depth 110
+setlocal & set DEPTH=111& set DEEP_VAR_111=changed at depth 111
+setlocal & set DEPTH=112& set DEEP_VAR_112=changed at depth 112
+setlocal & set DEPTH=113& set DEEP_VAR_113=changed at depth 113
+setlocal & set DEPTH=114& set DEEP_VAR_114=changed at depth 114
+setlocal & set DEPTH=115& set DEEP_VAR_115=changed at depth 115
+setlocal & set DEPTH=116& set DEEP_VAR_116=changed at depth 116
+setlocal & set DEPTH=117& set DEEP_VAR_117=changed at depth 117
+setlocal & set DEPTH=118& set DEEP_VAR_118=changed at depth 118
+setlocal & set DEPTH=119& set DEEP_VAR_119=changed at depth 119
+setlocal & set DEPTH=120& set DEEP_VAR_120=changed at depth 120
+setlocal & set DEPTH=121& set DEEP_VAR_121=changed at depth 121
+setlocal & set DEPTH=122& set DEEP_VAR_122=changed at depth 122
+setlocal & set DEPTH=123& set DEEP_VAR_123=changed at depth 123
+setlocal & set DEPTH=124& set DEEP_VAR_124=changed at depth 124
+setlocal & set DEPTH=125& set DEEP_VAR_125=changed at depth 125
+setlocal & set DEPTH=126& set DEEP_VAR_126=changed at depth 126
+setlocal & set DEPTH=127& set DEEP_VAR_127=changed at depth 127
+setlocal & set DEPTH=128& set DEEP_VAR_128=changed at depth 128
+setlocal & set DEPTH=129& set DEEP_VAR_129=changed at depth 129
+setlocal & set DEPTH=130& set DEEP_VAR_130=changed at depth 130
+setlocal & set DEPTH=131& set DEEP_VAR_131=changed at depth 131
+setlocal & set DEPTH=132& set DEEP_VAR_132=changed at depth 132
+setlocal & set DEPTH=133& set DEEP_VAR_133=changed at depth 133
+setlocal & set DEPTH=134& set DEEP_VAR_134=changed at depth 134
+setlocal & set DEPTH=135& set DEEP_VAR_135=changed at depth 135
+setlocal & set DEPTH=136& set DEEP_VAR_136=changed at depth 136
+setlocal & set DEPTH=137& set DEEP_VAR_137=changed at depth 137
+setlocal & set DEPTH=138& set DEEP_VAR_138=changed at depth 138
+setlocal & set DEPTH=139& set DEEP_VAR_139=changed at depth 139
+setlocal & set DEPTH=140& set DEEP_VAR_140=changed at depth 140
+setlocal & set DEPTH=141& set DEEP_VAR_141=changed at depth 141
+setlocal & set DEPTH=142& set DEEP_VAR_142=changed at depth 142
+setlocal & set DEPTH=143& set DEEP_VAR_143=changed at depth 143
+setlocal & set DEPTH=144& set DEEP_VAR_144=changed at depth 144
+setlocal & set DEPTH=145& set DEEP_VAR_145=changed at depth 145
+setlocal & set DEPTH=146& set DEEP_VAR_146=changed at depth 146
+setlocal & set DEPTH=147& set DEEP_VAR_147=changed at depth 147
+setlocal & set DEPTH=148& set DEEP_VAR_148=changed at depth 148
+setlocal & set DEPTH=149& set DEEP_VAR_149=changed at depth 149
+setlocal & set DEPTH=150& set DEEP_VAR_150=changed at depth 150
+setlocal & set DEPTH=151& set DEEP_VAR_151=changed at depth 151
+setlocal & set DEPTH=152& set DEEP_VAR_152=changed at depth 152
+setlocal & set DEPTH=153& set DEEP_VAR_153=changed at depth 153
+setlocal & set DEPTH=154& set DEEP_VAR_154=changed at depth 154
+setlocal & set DEPTH=155& set DEEP_VAR_155=changed at depth 155
+setlocal & set DEPTH=156& set DEEP_VAR_156=changed at depth 156
+setlocal & set DEPTH=157& set DEEP_VAR_157=changed at depth 157
+setlocal & set DEPTH=158& set DEEP_VAR_158=changed at depth 158
+setlocal & set DEPTH=159& set DEEP_VAR_159=changed at depth 159
+setlocal & set DEPTH=160& set DEEP_VAR_160=changed at depth 160
+setlocal & set DEPTH=161& set DEEP_VAR_161=changed at depth 161
+setlocal & set DEPTH=162& set DEEP_VAR_162=changed at depth 162
+setlocal & set DEPTH=163& set DEEP_VAR_163=changed at depth 163
+setlocal & set DEPTH=164& set DEEP_VAR_164=changed at depth 164
+setlocal & set DEPTH=165& set DEEP_VAR_165=changed at depth 165
+setlocal & set DEPTH=166& set DEEP_VAR_166=changed at depth 166
+setlocal & set DEPTH=167& set DEEP_VAR_167=changed at depth 167
+setlocal & set DEPTH=168& set DEEP_VAR_168=changed at depth 168
+setlocal & set DEPTH=169& set DEEP_VAR_169=changed at depth 169
+setlocal & set DEPTH=170& set DEEP_VAR_170=changed at depth 170
+setlocal & set DEPTH=171& set DEEP_VAR_171=changed at depth 171
+setlocal & set DEPTH=172& set DEEP_VAR_172=changed at depth 172
+setlocal & set DEPTH=173& set DEEP_VAR_173=changed at depth 173
+setlocal & set DEPTH=174& set DEEP_VAR_174=changed at depth 174
+setlocal & set DEPTH=175& set DEEP_VAR_175=changed at depth 175
+setlocal & set DEPTH=176& set DEEP_VAR_176=changed at depth 176
+setlocal & set DEPTH=177& set DEEP_VAR_177=changed at depth 177
+setlocal & set DEPTH=178& set DEEP_VAR_178=changed at depth 178
+setlocal & set DEPTH=179& set DEEP_VAR_179=changed at depth 179
+setlocal & set DEPTH=180& set DEEP_VAR_180=changed at depth 180
+setlocal & set DEPTH=181& set DEEP_VAR_181=changed at depth 181
+setlocal & set DEPTH=182& set DEEP_VAR_182=changed at depth 182
+setlocal & set DEPTH=183& set DEEP_VAR_183=changed at depth 183
+setlocal & set DEPTH=184& set DEEP_VAR_184=changed at depth 184
+setlocal & set DEPTH=185& set DEEP_VAR_185=changed at depth 185
+setlocal & set DEPTH=186& set DEEP_VAR_186=changed at depth 186
+setlocal & set DEPTH=187& set DEEP_VAR_187=changed at depth 187
+setlocal & set DEPTH=188& set DEEP_VAR_188=changed at depth 188
+setlocal & set DEPTH=189& set DEEP_VAR_189=changed at depth 189
+setlocal & set DEPTH=190& set DEEP_VAR_190=changed at depth 190
+setlocal & set DEPTH=191& set DEEP_VAR_191=changed at depth 191
+setlocal & set DEPTH=192& set DEEP_VAR_192=changed at depth 192
+setlocal & set DEPTH=193& set DEEP_VAR_193=changed at depth 193
+setlocal & set DEPTH=194& set DEEP_VAR_194=changed at depth 194
+setlocal & set DEPTH=195& set DEEP_VAR_195=changed at depth 195
+setlocal & set DEPTH=196& set DEEP_VAR_196=changed at depth 196
+setlocal & set DEPTH=197& set DEEP_VAR_197=changed at depth 197
+setlocal & set DEPTH=198& set DEEP_VAR_198=changed at depth 198
+setlocal & set DEPTH=199& set DEEP_VAR_199=changed at depth 199
+setlocal & set DEPTH=200& set DEEP_VAR_200=changed at depth 200
+setlocal & set DEPTH=201& set DEEP_VAR_201=changed at depth 201
+setlocal & set DEPTH=202& set DEEP_VAR_202=changed at depth 202
+setlocal & set DEPTH=203& set DEEP_VAR_203=changed at depth 203
+setlocal & set DEPTH=204& set DEEP_VAR_204=changed at depth 204
+setlocal & set DEPTH=205& set DEEP_VAR_205=changed at depth 205
+setlocal & set DEPTH=206& set DEEP_VAR_206=changed at depth 206
+setlocal & set DEPTH=207& set DEEP_VAR_207=changed at depth 207
+setlocal & set DEPTH=208& set DEEP_VAR_208=changed at depth 208
+setlocal & set DEPTH=209& set DEEP_VAR_209=changed at depth 209
+setlocal & set DEPTH=210& set DEEP_VAR_210=changed at depth 210
+setlocal & set DEPTH=211& set DEEP_VAR_211=changed at depth 211
+setlocal & set DEPTH=212& set DEEP_VAR_212=changed at depth 212
+setlocal & set DEPTH=213& set DEEP_VAR_213=changed at depth 213
+setlocal & set DEPTH=214& set DEEP_VAR_214=changed at depth 214
+setlocal & set DEPTH=215& set DEEP_VAR_215=changed at depth 215
+setlocal & set DEPTH=216& set DEEP_VAR_216=changed at depth 216
+setlocal & set DEPTH=217& set DEEP_VAR_217=changed at depth 217
+setlocal & set DEPTH=218& set DEEP_VAR_218=changed at depth 218
+setlocal & set DEPTH=219& set DEEP_VAR_219=changed at depth 219
+setlocal & set DEPTH=220& set DEEP_VAR_220=changed at depth 220
+setlocal & set DEPTH=221& set DEEP_VAR_221=changed at depth 221
+setlocal & set DEPTH=222& set DEEP_VAR_222=changed at depth 222
+setlocal & set DEPTH=223& set DEEP_VAR_223=changed at depth 223
+setlocal & set DEPTH=224& set DEEP_VAR_224=changed at depth 224
+setlocal & set DEPTH=225& set DEEP_VAR_225=changed at depth 225
+setlocal & set DEPTH=226& set DEEP_VAR_226=changed at depth 226
+setlocal & set DEPTH=227& set DEEP_VAR_227=changed at depth 227
+setlocal & set DEPTH=228& set DEEP_VAR_228=changed at depth 228
+setlocal & set DEPTH=229& set DEEP_VAR_229=changed at depth 229
+setlocal & set DEPTH=230& set DEEP_VAR_230=changed at depth 230
+setlocal & set DEPTH=231& set DEEP_VAR_231=changed at depth 231
+setlocal & set DEPTH=232& set DEEP_VAR_232=changed at depth 232
+setlocal & set DEPTH=233& set DEEP_VAR_233=changed at depth 233
+setlocal & set DEPTH=234& set DEEP_VAR_234=changed at depth 234
+setlocal & set DEPTH=235& set DEEP_VAR_235=changed at depth 235
+setlocal & set DEPTH=236& set DEEP_VAR_236=changed at depth 236
+setlocal & set DEPTH=237& set DEEP_VAR_237=changed at depth 237
+setlocal & set DEPTH=238& set DEEP_VAR_238=changed at depth 238
+setlocal & set DEPTH=239& set DEEP_VAR_239=changed at depth 239
+setlocal & set DEPTH=240& set DEEP_VAR_240=changed at depth 240
+setlocal & set DEPTH=241& set DEEP_VAR_241=changed at depth 241
+setlocal & set DEPTH=242& set DEEP_VAR_242=changed at depth 242
+setlocal & set DEPTH=243& set DEEP_VAR_243=changed at depth 243
+setlocal & set DEPTH=244& set DEEP_VAR_244=changed at depth 244
+setlocal & set DEPTH=245& set DEEP_VAR_245=changed at depth 245
+setlocal & set DEPTH=246& set DEEP_VAR_246=changed at depth 246
+setlocal & set DEPTH=247& set DEEP_VAR_247=changed at depth 247
+setlocal & set DEPTH=248& set DEEP_VAR_248=changed at depth 248
+setlocal & set DEPTH=249& set DEEP_VAR_249=changed at depth 249
+setlocal & set DEPTH=250& set DEEP_VAR_250=changed at depth 250
+setlocal & set DEPTH=251& set DEEP_VAR_251=changed at depth 251
+setlocal & set DEPTH=252& set DEEP_VAR_252=changed at depth 252
+setlocal & set DEPTH=253& set DEEP_VAR_253=changed at depth 253
+setlocal & set DEPTH=254& set DEEP_VAR_254=changed at depth 254
+setlocal & set DEPTH=255& set DEEP_VAR_255=changed at depth 255
+setlocal & set DEPTH=256& set DEEP_VAR_256=changed at depth 256
+setlocal & set DEPTH=257& set DEEP_VAR_257=changed at depth 257
+setlocal & set DEPTH=258& set DEEP_VAR_258=changed at depth 258
+setlocal & set DEPTH=259& set DEEP_VAR_259=changed at depth 259
+setlocal & set DEPTH=260& set DEEP_VAR_260=changed at depth 260
+setlocal & set DEPTH=261& set DEEP_VAR_261=changed at depth 261
+setlocal & set DEPTH=262& set DEEP_VAR_262=changed at depth 262
+setlocal & set DEPTH=263& set DEEP_VAR_263=changed at depth 263
+setlocal & set DEPTH=264& set DEEP_VAR_264=changed at depth 264
+setlocal & set DEPTH=265& set DEEP_VAR_265=changed at depth 265
+setlocal & set DEPTH=266& set DEEP_VAR_266=changed at depth 266
+setlocal & set DEPTH=267& set DEEP_VAR_267=changed at depth 267
+setlocal & set DEPTH=268& set DEEP_VAR_268=changed at depth 268
+setlocal & set DEPTH=269& set DEEP_VAR_269=changed at depth 269
+setlocal & set DEPTH=270& set DEEP_VAR_270=changed at depth 270
+setlocal & set DEPTH=271& set DEEP_VAR_271=changed at depth 271
+setlocal & set DEPTH=272& set DEEP_VAR_272=changed at depth 272
+setlocal & set DEPTH=273& set DEEP_VAR_273=changed at depth 273
+setlocal & set DEPTH=274& set DEEP_VAR_274=changed at depth 274
+setlocal & set DEPTH=275& set DEEP_VAR_275=changed at depth 275
+setlocal & set DEPTH=276& set DEEP_VAR_276=changed at depth 276
+setlocal & set DEPTH=277& set DEEP_VAR_277=changed at depth 277
+setlocal & set DEPTH=278& set DEEP_VAR_278=changed at depth 278
+setlocal & set DEPTH=279& set DEEP_VAR_279=changed at depth 279
+setlocal & set DEPTH=280& set DEEP_VAR_280=changed at depth 280
+setlocal & set DEPTH=281& set DEEP_VAR_281=changed at depth 281
+setlocal & set DEPTH=282& set DEEP_VAR_282=changed at depth 282
+setlocal & set DEPTH=283& set DEEP_VAR_283=changed at depth 283
+setlocal & set DEPTH=284& set DEEP_VAR_284=changed at depth 284
+setlocal & set DEPTH=285& set DEEP_VAR_285=changed at depth 285
+setlocal & set DEPTH=286& set DEEP_VAR_286=changed at depth 286
+setlocal & set DEPTH=287& set DEEP_VAR_287=changed at depth 287
+setlocal & set DEPTH=288& set DEEP_VAR_288=changed at depth 288
+setlocal & set DEPTH=289& set DEEP_VAR_289=changed at depth 289
+setlocal & set DEPTH=290& set DEEP_VAR_290=changed at depth 290
+setlocal & set DEPTH=291& set DEEP_VAR_291=changed at depth 291
+setlocal & set DEPTH=292& set DEEP_VAR_292=changed at depth 292
+setlocal & set DEPTH=293& set DEEP_VAR_293=changed at depth 293
+setlocal & set DEPTH=294& set DEEP_VAR_294=changed at depth 294
+setlocal & set DEPTH=295& set DEEP_VAR_295=changed at depth 295
+setlocal & set DEPTH=296& set DEEP_VAR_296=changed at depth 296
+setlocal & set DEPTH=297& set DEEP_VAR_297=changed at depth 297
+setlocal & set DEPTH=298& set DEEP_VAR_298=changed at depth 298
+setlocal & set DEPTH=299& set DEEP_VAR_299=changed at depth 299
+setlocal & set DEPTH=300& set DEEP_VAR_000=changed at depth 300
+setlocal & set DEPTH=301& set DEEP_VAR_001=changed at depth 301
+setlocal & set DEPTH=302& set DEEP_VAR_002=changed at depth 302
+setlocal & set DEPTH=303& set DEEP_VAR_003=changed at depth 303
+setlocal & set DEPTH=304& set DEEP_VAR_004=changed at depth 304
+setlocal & set DEPTH=305& set DEEP_VAR_005=changed at depth 305
+setlocal & set DEPTH=306& set DEEP_VAR_006=changed at depth 306
+setlocal & set DEPTH=307& set DEEP_VAR_007=changed at depth 307
+setlocal & set DEPTH=308& set DEEP_VAR_008=changed at depth 308
+setlocal & set DEPTH=309& set DEEP_VAR_009=changed at depth 309
+setlocal & set DEPTH=310& set DEEP_VAR_010=changed at depth 310
+setlocal & set DEPTH=311& set DEEP_VAR_011=changed at depth 311
+setlocal & set DEPTH=312& set DEEP_VAR_012=changed at depth 312
+setlocal & set DEPTH=313& set DEEP_VAR_013=changed at depth 313
+setlocal & set DEPTH=314& set DEEP_VAR_014=changed at depth 314
+setlocal & set DEPTH=315& set DEEP_VAR_015=changed at depth 315
+setlocal & set DEPTH=316& set DEEP_VAR_016=changed at depth 316
+setlocal & set DEPTH=317& set DEEP_VAR_017=changed at depth 317
+setlocal & set DEPTH=318& set DEEP_VAR_018=changed at depth 318
+setlocal & set DEPTH=319& set DEEP_VAR_019=changed at depth 319
+setlocal & set DEPTH=320& set DEEP_VAR_020=changed at depth 320
+setlocal & set DEPTH=321& set DEEP_VAR_021=changed at depth 321
+setlocal & set DEPTH=322& set DEEP_VAR_022=changed at depth 322
+setlocal & set DEPTH=323& set DEEP_VAR_023=changed at depth 323
+setlocal & set DEPTH=324& set DEEP_VAR_024=changed at depth 324
+setlocal & set DEPTH=325& set DEEP_VAR_025=changed at depth 325
+setlocal & set DEPTH=326& set DEEP_VAR_026=changed at depth 326
+setlocal & set DEPTH=327& set DEEP_VAR_027=changed at depth 327
+setlocal & set DEPTH=328& set DEEP_VAR_028=changed at depth 328
+setlocal & set DEPTH=329& set DEEP_VAR_029=changed at depth 329
+setlocal & set DEPTH=330& set DEEP_VAR_030=changed at depth 330
+setlocal & set DEPTH=331& set DEEP_VAR_031=changed at depth 331
+setlocal & set DEPTH=332& set DEEP_VAR_032=changed at depth 332
+setlocal & set DEPTH=333& set DEEP_VAR_033=changed at depth 333
+setlocal & set DEPTH=334& set DEEP_VAR_034=changed at depth 334
+setlocal & set DEPTH=335& set DEEP_VAR_035=changed at depth 335
+setlocal & set DEPTH=336& set DEEP_VAR_036=changed at depth 336
+setlocal & set DEPTH=337& set DEEP_VAR_037=changed at depth 337
+setlocal & set DEPTH=338& set DEEP_VAR_038=changed at depth 338
+setlocal & set DEPTH=339& set DEEP_VAR_039=changed at depth 339
+setlocal & set DEPTH=340& set DEEP_VAR_040=changed at depth 340
+setlocal & set DEPTH=341& set DEEP_VAR_041=changed at depth 341
+setlocal & set DEPTH=342& set DEEP_VAR_042=changed at depth 342
+setlocal & set DEPTH=343& set DEEP_VAR_043=changed at depth 343
+setlocal & set DEPTH=344& set DEEP_VAR_044=changed at depth 344
+setlocal & set DEPTH=345& set DEEP_VAR_045=changed at depth 345
+setlocal & set DEPTH=346& set DEEP_VAR_046=changed at depth 346
+setlocal & set DEPTH=347& set DEEP_VAR_047=changed at depth 347
+setlocal & set DEPTH=348& set DEEP_VAR_048=changed at depth 348
+setlocal & set DEPTH=349& set DEEP_VAR_049=changed at depth 349
+setlocal & set DEPTH=350& set DEEP_VAR_050=changed at depth 350
+setlocal & set DEPTH=351& set DEEP_VAR_051=changed at depth 351
+setlocal & set DEPTH=352& set DEEP_VAR_052=changed at depth 352
+setlocal & set DEPTH=353& set DEEP_VAR_053=changed at depth 353
+setlocal & set DEPTH=354& set DEEP_VAR_054=changed at depth 354
+setlocal & set DEPTH=355& set DEEP_VAR_055=changed at depth 355
+setlocal & set DEPTH=356& set DEEP_VAR_056=changed at depth 356
+setlocal & set DEPTH=357& set DEEP_VAR_057=changed at depth 357
+setlocal & set DEPTH=358& set DEEP_VAR_058=changed at depth 358
+setlocal & set DEPTH=359& set DEEP_VAR_059=changed at depth 359
+setlocal & set DEPTH=360& set DEEP_VAR_060=changed at depth 360
+setlocal & set DEPTH=361& set DEEP_VAR_061=changed at depth 361
+setlocal & set DEPTH=362& set DEEP_VAR_062=changed at depth 362
+setlocal & set DEPTH=363& set DEEP_VAR_063=changed at depth 363
+setlocal & set DEPTH=364& set DEEP_VAR_064=changed at depth 364
+setlocal & set DEPTH=365& set DEEP_VAR_065=changed at depth 365
+setlocal & set DEPTH=366& set DEEP_VAR_066=changed at depth 366
+setlocal & set DEPTH=367& set DEEP_VAR_067=changed at depth 367
+setlocal & set DEPTH=368& set DEEP_VAR_068=changed at depth 368
+setlocal & set DEPTH=369& set DEEP_VAR_069=changed at depth 369
+setlocal & set DEPTH=370& set DEEP_VAR_070=changed at depth 370
+setlocal & set DEPTH=371& set DEEP_VAR_071=changed at depth 371
+setlocal & set DEPTH=372& set DEEP_VAR_072=changed at depth 372
+setlocal & set DEPTH=373& set DEEP_VAR_073=changed at depth 373
+setlocal & set DEPTH=374& set DEEP_VAR_074=changed at depth 374
+setlocal & set DEPTH=375& set DEEP_VAR_075=changed at depth 375
+setlocal & set DEPTH=376& set DEEP_VAR_076=changed at depth 376
+setlocal & set DEPTH=377& set DEEP_VAR_077=changed at depth 377
+setlocal & set DEPTH=378& set DEEP_VAR_078=changed at depth 378
+setlocal & set DEPTH=379& set DEEP_VAR_079=changed at depth 379
+setlocal & set DEPTH=380& set DEEP_VAR_080=changed at depth 380
+setlocal & set DEPTH=381& set DEEP_VAR_081=changed at depth 381
+setlocal & set DEPTH=382& set DEEP_VAR_082=changed at depth 382
+setlocal & set DEPTH=383& set DEEP_VAR_083=changed at depth 383
+setlocal & set DEPTH=384& set DEEP_VAR_084=changed at depth 384
+setlocal & set DEPTH=385& set DEEP_VAR_085=changed at depth 385
+setlocal & set DEPTH=386& set DEEP_VAR_086=changed at depth 386
+setlocal & set DEPTH=387& set DEEP_VAR_087=changed at depth 387
+setlocal & set DEPTH=388& set DEEP_VAR_088=changed at depth 388
+setlocal & set DEPTH=389& set DEEP_VAR_089=changed at depth 389
+setlocal & set DEPTH=390& set DEEP_VAR_090=changed at depth 390
+setlocal & set DEPTH=391& set DEEP_VAR_091=changed at depth 391
+setlocal & set DEPTH=392& set DEEP_VAR_092=changed at depth 392
+setlocal & set DEPTH=393& set DEEP_VAR_093=changed at depth 393
+setlocal & set DEPTH=394& set DEEP_VAR_094=changed at depth 394
+setlocal & set DEPTH=395& set DEEP_VAR_095=changed at depth 395
+setlocal & set DEPTH=396& set DEEP_VAR_096=changed at depth 396
+setlocal & set DEPTH=397& set DEEP_VAR_097=changed at depth 397
+setlocal & set DEPTH=398& set DEEP_VAR_098=changed at depth 398
+setlocal & set DEPTH=399& set DEEP_VAR_099=changed at depth 399
+setlocal & set DEPTH=400& set DEEP_VAR_100=changed at depth 400
+setlocal & set DEPTH=401& set DEEP_VAR_101=changed at depth 401
+setlocal & set DEPTH=402& set DEEP_VAR_102=changed at depth 402
+setlocal & set DEPTH=403& set DEEP_VAR_103=changed at depth 403
+setlocal & set DEPTH=404& set DEEP_VAR_104=changed at depth 404
+setlocal & set DEPTH=405& set DEEP_VAR_105=changed at depth 405
+setlocal & set DEPTH=406& set DEEP_VAR_106=changed at depth 406
+setlocal & set DEPTH=407& set DEEP_VAR_107=changed at depth 407
+setlocal & set DEPTH=408& set DEEP_VAR_108=changed at depth 408
+setlocal & set DEPTH=409& set DEEP_VAR_109=changed at depth 409
+setlocal & set DEPTH=410& set DEEP_VAR_110=changed at depth 410
+setlocal & set DEPTH=411& set DEEP_VAR_111=changed at depth 411
+setlocal & set DEPTH=412& set DEEP_VAR_112=changed at depth 412
+setlocal & set DEPTH=413& set DEEP_VAR_113=changed at depth 413
+setlocal & set DEPTH=414& set DEEP_VAR_114=changed at depth 414
+setlocal & set DEPTH=415& set DEEP_VAR_115=changed at depth 415
+setlocal & set DEPTH=416& set DEEP_VAR_116=changed at depth 416
+setlocal & set DEPTH=417& set DEEP_VAR_117=changed at depth 417
+setlocal & set DEPTH=418& set DEEP_VAR_118=changed at depth 418
+setlocal & set DEPTH=419& set DEEP_VAR_119=changed at depth 419
+setlocal & set DEPTH=420& set DEEP_VAR_120=changed at depth 420
+setlocal & set DEPTH=421& set DEEP_VAR_121=changed at depth 421
+setlocal & set DEPTH=422& set DEEP_VAR_122=changed at depth 422
+setlocal & set DEPTH=423& set DEEP_VAR_123=changed at depth 423
+setlocal & set DEPTH=424& set DEEP_VAR_124=changed at depth 424
+setlocal & set DEPTH=425& set DEEP_VAR_125=changed at depth 425
+setlocal & set DEPTH=426& set DEEP_VAR_126=changed at depth 426
+setlocal & set DEPTH=427& set DEEP_VAR_127=changed at depth 427
+setlocal & set DEPTH=428& set DEEP_VAR_128=changed at depth 428
+setlocal & set DEPTH=429& set DEEP_VAR_129=changed at depth 429
+setlocal & set DEPTH=430& set DEEP_VAR_130=changed at depth 430
+setlocal & set DEPTH=431& set DEEP_VAR_131=changed at depth 431
+setlocal & set DEPTH=432& set DEEP_VAR_132=changed at depth 432
+setlocal & set DEPTH=433& set DEEP_VAR_133=changed at depth 433
+setlocal & set DEPTH=434& set DEEP_VAR_134=changed at depth 434
+setlocal & set DEPTH=435& set DEEP_VAR_135=changed at depth 435
+setlocal & set DEPTH=436& set DEEP_VAR_136=changed at depth 436
+setlocal & set DEPTH=437& set DEEP_VAR_137=changed at depth 437
+setlocal & set DEPTH=438& set DEEP_VAR_138=changed at depth 438
+setlocal & set DEPTH=439& set DEEP_VAR_139=changed at depth 439
+setlocal & set DEPTH=440& set DEEP_VAR_140=changed at depth 440
+setlocal & set DEPTH=441& set DEEP_VAR_141=changed at depth 441
+setlocal & set DEPTH=442& set DEEP_VAR_142=changed at depth 442
+setlocal & set DEPTH=443& set DEEP_VAR_143=changed at depth 443
+setlocal & set DEPTH=444& set DEEP_VAR_144=changed at depth 444
+setlocal & set DEPTH=445& set DEEP_VAR_145=changed at depth 445
+setlocal & set DEPTH=446& set DEEP_VAR_146=changed at depth 446
+setlocal & set DEPTH=447& set DEEP_VAR_147=changed at depth 447
+setlocal & set DEPTH=448& set DEEP_VAR_148=changed at depth 448
+setlocal & set DEPTH=449& set DEEP_VAR_149=changed at depth 449
+setlocal & set DEPTH=450& set DEEP_VAR_150=changed at depth 450
+setlocal & set DEPTH=451& set DEEP_VAR_151=changed at depth 451
+setlocal & set DEPTH=452& set DEEP_VAR_152=changed at depth 452
+setlocal & set DEPTH=453& set DEEP_VAR_153=changed at depth 453
+setlocal & set DEPTH=454& set DEEP_VAR_154=changed at depth 454
+setlocal & set DEPTH=455& set DEEP_VAR_155=changed at depth 455
+setlocal & set DEPTH=456& set DEEP_VAR_156=changed at depth 456
+setlocal & set DEPTH=457& set DEEP_VAR_157=changed at depth 457
+setlocal & set DEPTH=458& set DEEP_VAR_158=changed at depth 458
+setlocal & set DEPTH=459& set DEEP_VAR_159=changed at depth 459
+setlocal & set DEPTH=460& set DEEP_VAR_160=changed at depth 460
+setlocal & set DEPTH=461& set DEEP_VAR_161=changed at depth 461
+setlocal & set DEPTH=462& set DEEP_VAR_162=changed at depth 462
+setlocal & set DEPTH=463& set DEEP_VAR_163=changed at depth 463
+setlocal & set DEPTH=464& set DEEP_VAR_164=changed at depth 464
+setlocal & set DEPTH=465& set DEEP_VAR_165=changed at depth 465
+setlocal & set DEPTH=466& set DEEP_VAR_166=changed at depth 466
+setlocal & set DEPTH=467& set DEEP_VAR_167=changed at depth 467
+setlocal & set DEPTH=468& set DEEP_VAR_168=changed at depth 468
+setlocal & set DEPTH=469& set DEEP_VAR_169=changed at depth 469
+setlocal & set DEPTH=470& set DEEP_VAR_170=changed at depth 470
+setlocal & set DEPTH=471& set DEEP_VAR_171=changed at depth 471
+setlocal & set DEPTH=472& set DEEP_VAR_172=changed at depth 472
+setlocal & set DEPTH=473& set DEEP_VAR_173=changed at depth 473
+setlocal & set DEPTH=474& set DEEP_VAR_174=changed at depth 474
+setlocal & set DEPTH=475& set DEEP_VAR_175=changed at depth 475
+setlocal & set DEPTH=476& set DEEP_VAR_176=changed at depth 476
+setlocal & set DEPTH=477& set DEEP_VAR_177=changed at depth 477
+setlocal & set DEPTH=478& set DEEP_VAR_178=changed at depth 478
+setlocal & set DEPTH=479& set DEEP_VAR_179=changed at depth 479
+setlocal & set DEPTH=480& set DEEP_VAR_180=changed at depth 480
+setlocal & set DEPTH=481& set DEEP_VAR_181=changed at depth 481
+setlocal & set DEPTH=482& set DEEP_VAR_182=changed at depth 482
+setlocal & set DEPTH=483& set DEEP_VAR_183=changed at depth 483
+setlocal & set DEPTH=484& set DEEP_VAR_184=changed at depth 484
+setlocal & set DEPTH=485& set DEEP_VAR_185=changed at depth 485
+setlocal & set DEPTH=486& set DEEP_VAR_186=changed at depth 486
+setlocal & set DEPTH=487& set DEEP_VAR_187=changed at depth 487
+setlocal & set DEPTH=488& set DEEP_VAR_188=changed at depth 488
+setlocal & set DEPTH=489& set DEEP_VAR_189=changed at depth 489
+setlocal & set DEPTH=490& set DEEP_VAR_190=changed at depth 490
+setlocal & set DEPTH=491& set DEEP_VAR_191=changed at depth 491
+setlocal & set DEPTH=492& set DEEP_VAR_192=changed at depth 492
+setlocal & set DEPTH=493& set DEEP_VAR_193=changed at depth 493
+setlocal & set DEPTH=494& set DEEP_VAR_194=changed at depth 494
+setlocal & set DEPTH=495& set DEEP_VAR_195=changed at depth 495
+setlocal & set DEPTH=496& set DEEP_VAR_196=changed at depth 496
+setlocal & set DEPTH=497& set DEEP_VAR_197=changed at depth 497
+setlocal & set DEPTH=498& set DEEP_VAR_198=changed at depth 498
+setlocal & set DEPTH=499& set DEEP_VAR_199=changed at depth 499
+setlocal & set DEPTH=500& set DEEP_VAR_200=changed at depth 500
+setlocal & set DEPTH=501& set DEEP_VAR_201=changed at depth 501
+setlocal & set DEPTH=502& set DEEP_VAR_202=changed at depth 502
+setlocal & set DEPTH=503& set DEEP_VAR_203=changed at depth 503
+setlocal & set DEPTH=504& set DEEP_VAR_204=changed at depth 504
+setlocal & set DEPTH=505& set DEEP_VAR_205=changed at depth 505
+setlocal & set DEPTH=506& set DEEP_VAR_206=changed at depth 506
+setlocal & set DEPTH=507& set DEEP_VAR_207=changed at depth 507
+setlocal & set DEPTH=508& set DEEP_VAR_208=changed at depth 508
+setlocal & set DEPTH=509& set DEEP_VAR_209=changed at depth 509
+setlocal & set DEPTH=510& set DEEP_VAR_210=changed at depth 510
+setlocal & set DEPTH=511& set DEEP_VAR_211=changed at depth 511
+setlocal & set DEPTH=512& set DEEP_VAR_212=changed at depth 512
+setlocal & set DEPTH=513& set DEEP_VAR_213=changed at depth 513
+setlocal & set DEPTH=514& set DEEP_VAR_214=changed at depth 514
+setlocal & set DEPTH=515& set DEEP_VAR_215=changed at depth 515
+setlocal & set DEPTH=516& set DEEP_VAR_216=changed at depth 516
+setlocal & set DEPTH=517& set DEEP_VAR_217=changed at depth 517
+setlocal & set DEPTH=518& set DEEP_VAR_218=changed at depth 518
+setlocal & set DEPTH=519& set DEEP_VAR_219=changed at depth 519
+setlocal & set DEPTH=520& set DEEP_VAR_220=changed at depth 520
+setlocal & set DEPTH=521& set DEEP_VAR_221=changed at depth 521
+setlocal & set DEPTH=522& set DEEP_VAR_222=changed at depth 522
+setlocal & set DEPTH=523& set DEEP_VAR_223=changed at depth 523
+setlocal & set DEPTH=524& set DEEP_VAR_224=changed at depth 524
+setlocal & set DEPTH=525& set DEEP_VAR_225=changed at depth 525
+setlocal & set DEPTH=526& set DEEP_VAR_226=changed at depth 526
+setlocal & set DEPTH=527& set DEEP_VAR_227=changed at depth 527
+setlocal & set DEPTH=528& set DEEP_VAR_228=changed at depth 528
+setlocal & set DEPTH=529& set DEEP_VAR_229=changed at depth 529
+setlocal & set DEPTH=530& set DEEP_VAR_230=changed at depth 530
+setlocal & set DEPTH=531& set DEEP_VAR_231=changed at depth 531
+setlocal & set DEPTH=532& set DEEP_VAR_232=changed at depth 532
+setlocal & set DEPTH=533& set DEEP_VAR_233=changed at depth 533
+setlocal & set DEPTH=534& set DEEP_VAR_234=changed at depth 534
+setlocal & set DEPTH=535& set DEEP_VAR_235=changed at depth 535
+setlocal & set DEPTH=536& set DEEP_VAR_236=changed at depth 536
+setlocal & set DEPTH=537& set DEEP_VAR_237=changed at depth 537
+setlocal & set DEPTH=538& set DEEP_VAR_238=changed at depth 538
+setlocal & set DEPTH=539& set DEEP_VAR_239=changed at depth 539
+setlocal & set DEPTH=540& set DEEP_VAR_240=changed at depth 540
+setlocal & set DEPTH=541& set DEEP_VAR_241=changed at depth 541
+setlocal & set DEPTH=542& set DEEP_VAR_242=changed at depth 542
+setlocal & set DEPTH=543& set DEEP_VAR_243=changed at depth 543
+setlocal & set DEPTH=544& set DEEP_VAR_244=changed at depth 544
+setlocal & set DEPTH=545& set DEEP_VAR_245=changed at depth 545
+setlocal & set DEPTH=546& set DEEP_VAR_246=changed at depth 546
+setlocal & set DEPTH=547& set DEEP_VAR_247=changed at depth 547
+setlocal & set DEPTH=548& set DEEP_VAR_248=changed at depth 548
+setlocal & set DEPTH=549& set DEEP_VAR_249=changed at depth 549
+setlocal & set DEPTH=550& set DEEP_VAR_250=changed at depth 550
+setlocal & set DEPTH=551& set DEEP_VAR_251=changed at depth 551
+setlocal & set DEPTH=552& set DEEP_VAR_252=changed at depth 552
+setlocal & set DEPTH=553& set DEEP_VAR_253=changed at depth 553
+setlocal & set DEPTH=554& set DEEP_VAR_254=changed at depth 554
+setlocal & set DEPTH=555& set DEEP_VAR_255=changed at depth 555
+setlocal & set DEPTH=556& set DEEP_VAR_256=changed at depth 556
+setlocal & set DEPTH=557& set DEEP_VAR_257=changed at depth 557
+setlocal & set DEPTH=558& set DEEP_VAR_258=changed at depth 558
+setlocal & set DEPTH=559& set DEEP_VAR_259=changed at depth 559
+setlocal & set DEPTH=560& set DEEP_VAR_260=changed at depth 560
+setlocal & set DEPTH=561& set DEEP_VAR_261=changed at depth 561
+setlocal & set DEPTH=562& set DEEP_VAR_262=changed at depth 562
+setlocal & set DEPTH=563& set DEEP_VAR_263=changed at depth 563
+setlocal & set DEPTH=564& set DEEP_VAR_264=changed at depth 564
+setlocal & set DEPTH=565& set DEEP_VAR_265=changed at depth 565
+setlocal & set DEPTH=566& set DEEP_VAR_266=changed at depth 566
+setlocal & set DEPTH=567& set DEEP_VAR_267=changed at depth 567
+setlocal & set DEPTH=568& set DEEP_VAR_268=changed at depth 568
+setlocal & set DEPTH=569& set DEEP_VAR_269=changed at depth 569
+setlocal & set DEPTH=570& set DEEP_VAR_270=changed at depth 570
+setlocal & set DEPTH=571& set DEEP_VAR_271=changed at depth 571
+setlocal & set DEPTH=572& set DEEP_VAR_272=changed at depth 572
+setlocal & set DEPTH=573& set DEEP_VAR_273=changed at depth 573
+setlocal & set DEPTH=574& set DEEP_VAR_274=changed at depth 574
+setlocal & set DEPTH=575& set DEEP_VAR_275=changed at depth 575
+setlocal & set DEPTH=576& set DEEP_VAR_276=changed at depth 576
+setlocal & set DEPTH=577& set DEEP_VAR_277=changed at depth 577
+setlocal & set DEPTH=578& set DEEP_VAR_278=changed at depth 578
+setlocal & set DEPTH=579& set DEEP_VAR_279=changed at depth 579
+setlocal & set DEPTH=580& set DEEP_VAR_280=changed at depth 580
+setlocal & set DEPTH=581& set DEEP_VAR_281=changed at depth 581
+setlocal & set DEPTH=582& set DEEP_VAR_282=changed at depth 582
+setlocal & set DEPTH=583& set DEEP_VAR_283=changed at depth 583
+setlocal & set DEPTH=584& set DEEP_VAR_284=changed at depth 584
+setlocal & set DEPTH=585& set DEEP_VAR_285=changed at depth 585
+setlocal & set DEPTH=586& set DEEP_VAR_286=changed at depth 586
+setlocal & set DEPTH=587& set DEEP_VAR_287=changed at depth 587
+setlocal & set DEPTH=588& set DEEP_VAR_288=changed at depth 588
+setlocal & set DEPTH=589& set DEEP_VAR_289=changed at depth 589
+setlocal & set DEPTH=590& set DEEP_VAR_290=changed at depth 590
+setlocal & set DEPTH=591& set DEEP_VAR_291=changed at depth 591
+setlocal & set DEPTH=592& set DEEP_VAR_292=changed at depth 592
+setlocal & set DEPTH=593& set DEEP_VAR_293=changed at depth 593
+setlocal & set DEPTH=594& set DEEP_VAR_294=changed at depth 594
+setlocal & set DEPTH=595& set DEEP_VAR_295=changed at depth 595
+setlocal & set DEPTH=596& set DEEP_VAR_296=changed at depth 596
+setlocal & set DEPTH=597& set DEEP_VAR_297=changed at depth 597
+setlocal & set DEPTH=598& set DEEP_VAR_298=changed at depth 598
+setlocal & set DEPTH=599& set DEEP_VAR_299=changed at depth 599
+setlocal & set DEPTH=600& set DEEP_VAR_000=changed at depth 600
+setlocal & set DEPTH=601& set DEEP_VAR_001=changed at depth 601
+setlocal & set DEPTH=602& set DEEP_VAR_002=changed at depth 602
+setlocal & set DEPTH=603& set DEEP_VAR_003=changed at depth 603
+setlocal & set DEPTH=604& set DEEP_VAR_004=changed at depth 604
+setlocal & set DEPTH=605& set DEEP_VAR_005=changed at depth 605
+setlocal & set DEPTH=606& set DEEP_VAR_006=changed at depth 606
+setlocal & set DEPTH=607& set DEEP_VAR_007=changed at depth 607
+setlocal & set DEPTH=608& set DEEP_VAR_008=changed at depth 608
+setlocal & set DEPTH=609& set DEEP_VAR_009=changed at depth 609
+setlocal & set DEPTH=610& set DEEP_VAR_010=changed at depth 610
+setlocal & set DEPTH=611& set DEEP_VAR_011=changed at depth 611
+setlocal & set DEPTH=612& set DEEP_VAR_012=changed at depth 612
+setlocal & set DEPTH=613& set DEEP_VAR_013=changed at depth 613
+setlocal & set DEPTH=614& set DEEP_VAR_014=changed at depth 614
+setlocal & set DEPTH=615& set DEEP_VAR_015=changed at depth 615
+setlocal & set DEPTH=616& set DEEP_VAR_016=changed at depth 616
+setlocal & set DEPTH=617& set DEEP_VAR_017=changed at depth 617
+setlocal & set DEPTH=618& set DEEP_VAR_018=changed at depth 618
+setlocal & set DEPTH=619& set DEEP_VAR_019=changed at depth 619
+setlocal & set DEPTH=620& set DEEP_VAR_020=changed at depth 620
+setlocal & set DEPTH=621& set DEEP_VAR_021=changed at depth 621
+setlocal & set DEPTH=622& set DEEP_VAR_022=changed at depth 622
+setlocal & set DEPTH=623& set DEEP_VAR_023=changed at depth 623
+setlocal & set DEPTH=624& set DEEP_VAR_024=changed at depth 624
+setlocal & set DEPTH=625& set DEEP_VAR_025=changed at depth 625
+setlocal & set DEPTH=626& set DEEP_VAR_026=changed at depth 626
+setlocal & set DEPTH=627& set DEEP_VAR_027=changed at depth 627
+setlocal & set DEPTH=628& set DEEP_VAR_028=changed at depth 628
+setlocal & set DEPTH=629& set DEEP_VAR_029=changed at depth 629
+setlocal & set DEPTH=630& set DEEP_VAR_030=changed at depth 630
+setlocal & set DEPTH=631& set DEEP_VAR_031=changed at depth 631
+setlocal & set DEPTH=632& set DEEP_VAR_032=changed at depth 632
+setlocal & set DEPTH=633& set DEEP_VAR_033=changed at depth 633
+setlocal & set DEPTH=634& set DEEP_VAR_034=changed at depth 634
+setlocal & set DEPTH=635& set DEEP_VAR_035=changed at depth 635
+setlocal & set DEPTH=636& set DEEP_VAR_036=changed at depth 636
+setlocal & set DEPTH=637& set DEEP_VAR_037=changed at depth 637
+setlocal & set DEPTH=638& set DEEP_VAR_038=changed at depth 638
+setlocal & set DEPTH=639& set DEEP_VAR_039=changed at depth 639
+setlocal & set DEPTH=640& set DEEP_VAR_040=changed at depth 640
+setlocal & set DEPTH=641& set DEEP_VAR_041=changed at depth 641
+setlocal & set DEPTH=642& set DEEP_VAR_042=changed at depth 642
+setlocal & set DEPTH=643& set DEEP_VAR_043=changed at depth 643
+setlocal & set DEPTH=644& set DEEP_VAR_044=changed at depth 644
+setlocal & set DEPTH=645& set DEEP_VAR_045=changed at depth 645
+setlocal & set DEPTH=646& set DEEP_VAR_046=changed at depth 646
+setlocal & set DEPTH=647& set DEEP_VAR_047=changed at depth 647
+setlocal & set DEPTH=648& set DEEP_VAR_048=changed at depth 648
+setlocal & set DEPTH=649& set DEEP_VAR_049=changed at depth 649
+setlocal & set DEPTH=650& set DEEP_VAR_050=changed at depth 650
+setlocal & set DEPTH=651& set DEEP_VAR_051=changed at depth 651
+setlocal & set DEPTH=652& set DEEP_VAR_052=changed at depth 652
+setlocal & set DEPTH=653& set DEEP_VAR_053=changed at depth 653
+setlocal & set DEPTH=654& set DEEP_VAR_054=changed at depth 654
+setlocal & set DEPTH=655& set DEEP_VAR_055=changed at depth 655
+setlocal & set DEPTH=656& set DEEP_VAR_056=changed at depth 656
+setlocal & set DEPTH=657& set DEEP_VAR_057=changed at depth 657
+setlocal & set DEPTH=658& set DEEP_VAR_058=changed at depth 658
+setlocal & set DEPTH=659& set DEEP_VAR_059=changed at depth 659
+setlocal & set DEPTH=660& set DEEP_VAR_060=changed at depth 660
+setlocal & set DEPTH=661& set DEEP_VAR_061=changed at depth 661
+setlocal & set DEPTH=662& set DEEP_VAR_062=changed at depth 662
+setlocal & set DEPTH=663& set DEEP_VAR_063=changed at depth 663
+setlocal & set DEPTH=664& set DEEP_VAR_064=changed at depth 664
+setlocal & set DEPTH=665& set DEEP_VAR_065=changed at depth 665
+setlocal & set DEPTH=666& set DEEP_VAR_066=changed at depth 666
+setlocal & set DEPTH=667& set DEEP_VAR_067=changed at depth 667
+setlocal & set DEPTH=668& set DEEP_VAR_068=changed at depth 668
+setlocal & set DEPTH=669& set DEEP_VAR_069=changed at depth 669
+setlocal & set DEPTH=670& set DEEP_VAR_070=changed at depth 670
+setlocal & set DEPTH=671& set DEEP_VAR_071=changed at depth 671
+setlocal & set DEPTH=672& set DEEP_VAR_072=changed at depth 672
+setlocal & set DEPTH=673& set DEEP_VAR_073=changed at depth 673
+setlocal & set DEPTH=674& set DEEP_VAR_074=changed at depth 674
+setlocal & set DEPTH=675& set DEEP_VAR_075=changed at depth 675
+setlocal & set DEPTH=676& set DEEP_VAR_076=changed at depth 676
+setlocal & set DEPTH=677& set DEEP_VAR_077=changed at depth 677
+setlocal & set DEPTH=678& set DEEP_VAR_078=changed at depth 678
+setlocal & set DEPTH=679& set DEEP_VAR_079=changed at depth 679
+setlocal & set DEPTH=680& set DEEP_VAR_080=changed at depth 680
+setlocal & set DEPTH=681& set DEEP_VAR_081=changed at depth 681
+setlocal & set DEPTH=682& set DEEP_VAR_082=changed at depth 682
+setlocal & set DEPTH=683& set DEEP_VAR_083=changed at depth 683
+setlocal & set DEPTH=684& set DEEP_VAR_084=changed at depth 684
+setlocal & set DEPTH=685& set DEEP_VAR_085=changed at depth 685
+setlocal & set DEPTH=686& set DEEP_VAR_086=changed at depth 686
+setlocal & set DEPTH=687& set DEEP_VAR_087=changed at depth 687
+setlocal & set DEPTH=688& set DEEP_VAR_088=changed at depth 688
+setlocal & set DEPTH=689& set DEEP_VAR_089=changed at depth 689
+setlocal & set DEPTH=690& set DEEP_VAR_090=changed at depth 690
+setlocal & set DEPTH=691& set DEEP_VAR_091=changed at depth 691
+setlocal & set DEPTH=692& set DEEP_VAR_092=changed at depth 692
+setlocal & set DEPTH=693& set DEEP_VAR_093=changed at depth 693
+setlocal & set DEPTH=694& set DEEP_VAR_094=changed at depth 694
+setlocal & set DEPTH=695& set DEEP_VAR_095=changed at depth 695
+setlocal & set DEPTH=696& set DEEP_VAR_096=changed at depth 696
+setlocal & set DEPTH=697& set DEEP_VAR_097=changed at depth 697
+setlocal & set DEPTH=698& set DEEP_VAR_098=changed at depth 698
+setlocal & set DEPTH=699& set DEEP_VAR_099=changed at depth 699
+setlocal & set DEPTH=700& set DEEP_VAR_100=changed at depth 700
+setlocal & set DEPTH=701& set DEEP_VAR_101=changed at depth 701
+setlocal & set DEPTH=702& set DEEP_VAR_102=changed at depth 702
+setlocal & set DEPTH=703& set DEEP_VAR_103=changed at depth 703
+setlocal & set DEPTH=704& set DEEP_VAR_104=changed at depth 704
+setlocal & set DEPTH=705& set DEEP_VAR_105=changed at depth 705
+setlocal & set DEPTH=706& set DEEP_VAR_106=changed at depth 706
+setlocal & set DEPTH=707& set DEEP_VAR_107=changed at depth 707
+setlocal & set DEPTH=708& set DEEP_VAR_108=changed at depth 708
+setlocal & set DEPTH=709& set DEEP_VAR_109=changed at depth 709
+setlocal & set DEPTH=710& set DEEP_VAR_110=changed at depth 710
+setlocal & set DEPTH=711& set DEEP_VAR_111=changed at depth 711
+setlocal & set DEPTH=712& set DEEP_VAR_112=changed at depth 712
+setlocal & set DEPTH=713& set DEEP_VAR_113=changed at depth 713
+setlocal & set DEPTH=714& set DEEP_VAR_114=changed at depth 714
+setlocal & set DEPTH=715& set DEEP_VAR_115=changed at depth 715
+setlocal & set DEPTH=716& set DEEP_VAR_116=changed at depth 716
+setlocal & set DEPTH=717& set DEEP_VAR_117=changed at depth 717
+setlocal & set DEPTH=718& set DEEP_VAR_118=changed at depth 718
+setlocal & set DEPTH=719& set DEEP_VAR_119=changed at depth 719
+setlocal & set DEPTH=720& set DEEP_VAR_120=changed at depth 720
+setlocal & set DEPTH=721& set DEEP_VAR_121=changed at depth 721
+setlocal & set DEPTH=722& set DEEP_VAR_122=changed at depth 722
+setlocal & set DEPTH=723& set DEEP_VAR_123=changed at depth 723
+setlocal & set DEPTH=724& set DEEP_VAR_124=changed at depth 724
+setlocal & set DEPTH=725& set DEEP_VAR_125=changed at depth 725
+setlocal & set DEPTH=726& set DEEP_VAR_126=changed at depth 726
+setlocal & set DEPTH=727& set DEEP_VAR_127=changed at depth 727
+setlocal & set DEPTH=728& set DEEP_VAR_128=changed at depth 728
+setlocal & set DEPTH=729& set DEEP_VAR_129=changed at depth 729
+setlocal & set DEPTH=730& set DEEP_VAR_130=changed at depth 730
+setlocal & set DEPTH=731& set DEEP_VAR_131=changed at depth 731
+setlocal & set DEPTH=732& set DEEP_VAR_132=changed at depth 732
+setlocal & set DEPTH=733& set DEEP_VAR_133=changed at depth 733
+setlocal & set DEPTH=734& set DEEP_VAR_134=changed at depth 734
+setlocal & set DEPTH=735& set DEEP_VAR_135=changed at depth 735
+setlocal & set DEPTH=736& set DEEP_VAR_136=changed at depth 736
+setlocal & set DEPTH=737& set DEEP_VAR_137=changed at depth 737
+setlocal & set DEPTH=738& set DEEP_VAR_138=changed at depth 738
+setlocal & set DEPTH=739& set DEEP_VAR_139=changed at depth 739
+setlocal & set DEPTH=740& set DEEP_VAR_140=changed at depth 740
+setlocal & set DEPTH=741& set DEEP_VAR_141=changed at depth 741
+setlocal & set DEPTH=742& set DEEP_VAR_142=changed at depth 742
+setlocal & set DEPTH=743& set DEEP_VAR_143=changed at depth 743
+setlocal & set DEPTH=744& set DEEP_VAR_144=changed at depth 744
+setlocal & set DEPTH=745& set DEEP_VAR_145=changed at depth 745
+setlocal & set DEPTH=746& set DEEP_VAR_146=changed at depth 746
+setlocal & set DEPTH=747& set DEEP_VAR_147=changed at depth 747
+setlocal & set DEPTH=748& set DEEP_VAR_148=changed at depth 748
+setlocal & set DEPTH=749& set DEEP_VAR_149=changed at depth 749
+setlocal & set DEPTH=750& set DEEP_VAR_150=changed at depth 750
+setlocal & set DEPTH=751& set DEEP_VAR_151=changed at depth 751
+setlocal & set DEPTH=752& set DEEP_VAR_152=changed at depth 752
+setlocal & set DEPTH=753& set DEEP_VAR_153=changed at depth 753
+setlocal & set DEPTH=754& set DEEP_VAR_154=changed at depth 754
+setlocal & set DEPTH=755& set DEEP_VAR_155=changed at depth 755
+setlocal & set DEPTH=756& set DEEP_VAR_156=changed at depth 756
+setlocal & set DEPTH=757& set DEEP_VAR_157=changed at depth 757
+setlocal & set DEPTH=758& set DEEP_VAR_158=changed at depth 758
+setlocal & set DEPTH=759& set DEEP_VAR_159=changed at depth 759
+setlocal & set DEPTH=760& set DEEP_VAR_160=changed at depth 760
+setlocal & set DEPTH=761& set DEEP_VAR_161=changed at depth 761
+setlocal & set DEPTH=762& set DEEP_VAR_162=changed at depth 762
+setlocal & set DEPTH=763& set DEEP_VAR_163=changed at depth 763
+setlocal & set DEPTH=764& set DEEP_VAR_164=changed at depth 764
+setlocal & set DEPTH=765& set DEEP_VAR_165=changed at depth 765
+setlocal & set DEPTH=766& set DEEP_VAR_166=changed at depth 766
+setlocal & set DEPTH=767& set DEEP_VAR_167=changed at depth 767
+setlocal & set DEPTH=768& set DEEP_VAR_168=changed at depth 768
+setlocal & set DEPTH=769& set DEEP_VAR_169=changed at depth 769
+setlocal & set DEPTH=770& set DEEP_VAR_170=changed at depth 770
+setlocal & set DEPTH=771& set DEEP_VAR_171=changed at depth 771
+setlocal & set DEPTH=772& set DEEP_VAR_172=changed at depth 772
+setlocal & set DEPTH=773& set DEEP_VAR_173=changed at depth 773
+setlocal & set DEPTH=774& set DEEP_VAR_174=changed at depth 774
+setlocal & set DEPTH=775& set DEEP_VAR_175=changed at depth 775
+setlocal & set DEPTH=776& set DEEP_VAR_176=changed at depth 776
+setlocal & set DEPTH=777& set DEEP_VAR_177=changed at depth 777
+setlocal & set DEPTH=778& set DEEP_VAR_178=changed at depth 778
+setlocal & set DEPTH=779& set DEEP_VAR_179=changed at depth 779
+setlocal & set DEPTH=780& set DEEP_VAR_180=changed at depth 780
+setlocal & set DEPTH=781& set DEEP_VAR_181=changed at depth 781
+setlocal & set DEPTH=782& set DEEP_VAR_182=changed at depth 782
+setlocal & set DEPTH=783& set DEEP_VAR_183=changed at depth 783
+setlocal & set DEPTH=784& set DEEP_VAR_184=changed at depth 784
+setlocal & set DEPTH=785& set DEEP_VAR_185=changed at depth 785
+setlocal & set DEPTH=786& set DEEP_VAR_186=changed at depth 786
+setlocal & set DEPTH=787& set DEEP_VAR_187=changed at depth 787
+setlocal & set DEPTH=788& set DEEP_VAR_188=changed at depth 788
+setlocal & set DEPTH=789& set DEEP_VAR_189=changed at depth 789
+setlocal & set DEPTH=790& set DEEP_VAR_190=changed at depth 790
+setlocal & set DEPTH=791& set DEEP_VAR_191=changed at depth 791
+setlocal & set DEPTH=792& set DEEP_VAR_192=changed at depth 792
+setlocal & set DEPTH=793& set DEEP_VAR_193=changed at depth 793
+setlocal & set DEPTH=794& set DEEP_VAR_194=changed at depth 794
+setlocal & set DEPTH=795& set DEEP_VAR_195=changed at depth 795
+setlocal & set DEPTH=796& set DEEP_VAR_196=changed at depth 796
+setlocal & set DEPTH=797& set DEEP_VAR_197=changed at depth 797
+setlocal & set DEPTH=798& set DEEP_VAR_198=changed at depth 798
+setlocal & set DEPTH=799& set DEEP_VAR_199=changed at depth 799
+setlocal & set DEPTH=800& set DEEP_VAR_200=changed at depth 800
+setlocal & set DEPTH=801& set DEEP_VAR_201=changed at depth 801
+setlocal & set DEPTH=802& set DEEP_VAR_202=changed at depth 802
+setlocal & set DEPTH=803& set DEEP_VAR_203=changed at depth 803
+setlocal & set DEPTH=804& set DEEP_VAR_204=changed at depth 804
+setlocal & set DEPTH=805& set DEEP_VAR_205=changed at depth 805
+setlocal & set DEPTH=806& set DEEP_VAR_206=changed at depth 806
+setlocal & set DEPTH=807& set DEEP_VAR_207=changed at depth 807
+setlocal & set DEPTH=808& set DEEP_VAR_208=changed at depth 808
+setlocal & set DEPTH=809& set DEEP_VAR_209=changed at depth 809
+setlocal & set DEPTH=810& set DEEP_VAR_210=changed at depth 810
+setlocal & set DEPTH=811& set DEEP_VAR_211=changed at depth 811
+setlocal & set DEPTH=812& set DEEP_VAR_212=changed at depth 812
+setlocal & set DEPTH=813& set DEEP_VAR_213=changed at depth 813
+setlocal & set DEPTH=814& set DEEP_VAR_214=changed at depth 814
+setlocal & set DEPTH=815& set DEEP_VAR_215=changed at depth 815
+setlocal & set DEPTH=816& set DEEP_VAR_216=changed at depth 816
+setlocal & set DEPTH=817& set DEEP_VAR_217=changed at depth 817
+setlocal & set DEPTH=818& set DEEP_VAR_218=changed at depth 818
+setlocal & set DEPTH=819& set DEEP_VAR_219=changed at depth 819
+setlocal & set DEPTH=820& set DEEP_VAR_220=changed at depth 820
+setlocal & set DEPTH=821& set DEEP_VAR_221=changed at depth 821
+setlocal & set DEPTH=822& set DEEP_VAR_222=changed at depth 822
+setlocal & set DEPTH=823& set DEEP_VAR_223=changed at depth 823
+setlocal & set DEPTH=824& set DEEP_VAR_224=changed at depth 824
+setlocal & set DEPTH=825& set DEEP_VAR_225=changed at depth 825
+setlocal & set DEPTH=826& set DEEP_VAR_226=changed at depth 826
+setlocal & set DEPTH=827& set DEEP_VAR_227=changed at depth 827
+setlocal & set DEPTH=828& set DEEP_VAR_228=changed at depth 828
+setlocal & set DEPTH=829& set DEEP_VAR_229=changed at depth 829
+setlocal & set DEPTH=830& set DEEP_VAR_230=changed at depth 830
+setlocal & set DEPTH=831& set DEEP_VAR_231=changed at depth 831
+setlocal & set DEPTH=832& set DEEP_VAR_232=changed at depth 832
+setlocal & set DEPTH=833& set DEEP_VAR_233=changed at depth 833
+setlocal & set DEPTH=834& set DEEP_VAR_234=changed at depth 834
+setlocal & set DEPTH=835& set DEEP_VAR_235=changed at depth 835
+setlocal & set DEPTH=836& set DEEP_VAR_236=changed at depth 836
+setlocal & set DEPTH=837& set DEEP_VAR_237=changed at depth 837
+setlocal & set DEPTH=838& set DEEP_VAR_238=changed at depth 838
+setlocal & set DEPTH=839& set DEEP_VAR_239=changed at depth 839
+setlocal & set DEPTH=840& set DEEP_VAR_240=changed at depth 840
+setlocal & set DEPTH=841& set DEEP_VAR_241=changed at depth 841
+setlocal & set DEPTH=842& set DEEP_VAR_242=changed at depth 842
+setlocal & set DEPTH=843& set DEEP_VAR_243=changed at depth 843
+setlocal & set DEPTH=844& set DEEP_VAR_244=changed at depth 844
+setlocal & set DEPTH=845& set DEEP_VAR_245=changed at depth 845
+setlocal & set DEPTH=846& set DEEP_VAR_246=changed at depth 846
+setlocal & set DEPTH=847& set DEEP_VAR_247=changed at depth 847
+setlocal & set DEPTH=848& set DEEP_VAR_248=changed at depth 848
+setlocal & set DEPTH=849& set DEEP_VAR_249=changed at depth 849
+setlocal & set DEPTH=850& set DEEP_VAR_250=changed at depth 850
+setlocal & set DEPTH=851& set DEEP_VAR_251=changed at depth 851
+setlocal & set DEPTH=852& set DEEP_VAR_252=changed at depth 852
+setlocal & set DEPTH=853& set DEEP_VAR_253=changed at depth 853
+setlocal & set DEPTH=854& set DEEP_VAR_254=changed at depth 854
+setlocal & set DEPTH=855& set DEEP_VAR_255=changed at depth 855
+setlocal & set DEPTH=856& set DEEP_VAR_256=changed at depth 856
+setlocal & set DEPTH=857& set DEEP_VAR_257=changed at depth 857
+setlocal & set DEPTH=858& set DEEP_VAR_258=changed at depth 858
+setlocal & set DEPTH=859& set DEEP_VAR_259=changed at depth 859
+setlocal & set DEPTH=860& set DEEP_VAR_260=changed at depth 860
+setlocal & set DEPTH=861& set DEEP_VAR_261=changed at depth 861
+setlocal & set DEPTH=862& set DEEP_VAR_262=changed at depth 862
+setlocal & set DEPTH=863& set DEEP_VAR_263=changed at depth 863
+setlocal & set DEPTH=864& set DEEP_VAR_264=changed at depth 864
+setlocal & set DEPTH=865& set DEEP_VAR_265=changed at depth 865
+setlocal & set DEPTH=866& set DEEP_VAR_266=changed at depth 866
+setlocal & set DEPTH=867& set DEEP_VAR_267=changed at depth 867
+setlocal & set DEPTH=868& set DEEP_VAR_268=changed at depth 868
+setlocal & set DEPTH=869& set DEEP_VAR_269=changed at depth 869
+setlocal & set DEPTH=870& set DEEP_VAR_270=changed at depth 870
+setlocal & set DEPTH=871& set DEEP_VAR_271=changed at depth 871
+setlocal & set DEPTH=872& set DEEP_VAR_272=changed at depth 872
+setlocal & set DEPTH=873& set DEEP_VAR_273=changed at depth 873
+setlocal & set DEPTH=874& set DEEP_VAR_274=changed at depth 874
+setlocal & set DEPTH=875& set DEEP_VAR_275=changed at depth 875
+setlocal & set DEPTH=876& set DEEP_VAR_276=changed at depth 876
+setlocal & set DEPTH=877& set DEEP_VAR_277=changed at depth 877
+setlocal & set DEPTH=878& set DEEP_VAR_278=changed at depth 878
+setlocal & set DEPTH=879& set DEEP_VAR_279=changed at depth 879
+setlocal & set DEPTH=880& set DEEP_VAR_280=changed at depth 880
+setlocal & set DEPTH=881& set DEEP_VAR_281=changed at depth 881
+setlocal & set DEPTH=882& set DEEP_VAR_282=changed at depth 882
+setlocal & set DEPTH=883& set DEEP_VAR_283=changed at depth 883
+setlocal & set DEPTH=884& set DEEP_VAR_284=changed at depth 884
+setlocal & set DEPTH=885& set DEEP_VAR_285=changed at depth 885
+setlocal & set DEPTH=886& set DEEP_VAR_286=changed at depth 886
+setlocal & set DEPTH=887& set DEEP_VAR_287=changed at depth 887
+setlocal & set DEPTH=888& set DEEP_VAR_288=changed at depth 888
+setlocal & set DEPTH=889& set DEEP_VAR_289=changed at depth 889
+setlocal & set DEPTH=890& set DEEP_VAR_290=changed at depth 890
+setlocal & set DEPTH=891& set DEEP_VAR_291=changed at depth 891
+setlocal & set DEPTH=892& set DEEP_VAR_292=changed at depth 892
+setlocal & set DEPTH=893& set DEEP_VAR_293=changed at depth 893
+setlocal & set DEPTH=894& set DEEP_VAR_294=changed at depth 894
+setlocal & set DEPTH=895& set DEEP_VAR_295=changed at depth 895
+setlocal & set DEPTH=896& set DEEP_VAR_296=changed at depth 896
+setlocal & set DEPTH=897& set DEEP_VAR_297=changed at depth 897
+setlocal & set DEPTH=898& set DEEP_VAR_298=changed at depth 898
+setlocal & set DEPTH=899& set DEEP_VAR_299=changed at depth 899
+setlocal & set DEPTH=900& set DEEP_VAR_000=changed at depth 900
+setlocal & set DEPTH=901& set DEEP_VAR_001=changed at depth 901
+setlocal & set DEPTH=902& set DEEP_VAR_002=changed at depth 902
+setlocal & set DEPTH=903& set DEEP_VAR_003=changed at depth 903
+setlocal & set DEPTH=904& set DEEP_VAR_004=changed at depth 904
+setlocal & set DEPTH=905& set DEEP_VAR_005=changed at depth 905
+setlocal & set DEPTH=906& set DEEP_VAR_006=changed at depth 906
+setlocal & set DEPTH=907& set DEEP_VAR_007=changed at depth 907
+setlocal & set DEPTH=908& set DEEP_VAR_008=changed at depth 908
+setlocal & set DEPTH=909& set DEEP_VAR_009=changed at depth 909
+setlocal & set DEPTH=910& set DEEP_VAR_010=changed at depth 910
+setlocal & set DEPTH=911& set DEEP_VAR_011=changed at depth 911
+setlocal & set DEPTH=912& set DEEP_VAR_012=changed at depth 912
+setlocal & set DEPTH=913& set DEEP_VAR_013=changed at depth 913
+setlocal & set DEPTH=914& set DEEP_VAR_014=changed at depth 914
+setlocal & set DEPTH=915& set DEEP_VAR_015=changed at depth 915
+setlocal & set DEPTH=916& set DEEP_VAR_016=changed at depth 916
+setlocal & set DEPTH=917& set DEEP_VAR_017=changed at depth 917
+setlocal & set DEPTH=918& set DEEP_VAR_018=changed at depth 918
+setlocal & set DEPTH=919& set DEEP_VAR_019=changed at depth 919
+setlocal & set DEPTH=920& set DEEP_VAR_020=changed at depth 920
+setlocal & set DEPTH=921& set DEEP_VAR_021=changed at depth 921
+setlocal & set DEPTH=922& set DEEP_VAR_022=changed at depth 922
+setlocal & set DEPTH=923& set DEEP_VAR_023=changed at depth 923
+setlocal & set DEPTH=924& set DEEP_VAR_024=changed at depth 924
+setlocal & set DEPTH=925& set DEEP_VAR_025=changed at depth 925
+setlocal & set DEPTH=926& set DEEP_VAR_026=changed at depth 926
+setlocal & set DEPTH=927& set DEEP_VAR_027=changed at depth 927
+setlocal & set DEPTH=928& set DEEP_VAR_028=changed at depth 928
+setlocal & set DEPTH=929& set DEEP_VAR_029=changed at depth 929
+setlocal & set DEPTH=930& set DEEP_VAR_030=changed at depth 930
+setlocal & set DEPTH=931& set DEEP_VAR_031=changed at depth 931
+setlocal & set DEPTH=932& set DEEP_VAR_032=changed at depth 932
+setlocal & set DEPTH=933& set DEEP_VAR_033=changed at depth 933
+setlocal & set DEPTH=934& set DEEP_VAR_034=changed at depth 934
+setlocal & set DEPTH=935& set DEEP_VAR_035=changed at depth 935
+setlocal & set DEPTH=936& set DEEP_VAR_036=changed at depth 936
+setlocal & set DEPTH=937& set DEEP_VAR_037=changed at depth 937
+setlocal & set DEPTH=938& set DEEP_VAR_038=changed at depth 938
+setlocal & set DEPTH=939& set DEEP_VAR_039=changed at depth 939
+setlocal & set DEPTH=940& set DEEP_VAR_040=changed at depth 940
+setlocal & set DEPTH=941& set DEEP_VAR_041=changed at depth 941
+setlocal & set DEPTH=942& set DEEP_VAR_042=changed at depth 942
+setlocal & set DEPTH=943& set DEEP_VAR_043=changed at depth 943
+setlocal & set DEPTH=944& set DEEP_VAR_044=changed at depth 944
+setlocal & set DEPTH=945& set DEEP_VAR_045=changed at depth 945
+setlocal & set DEPTH=946& set DEEP_VAR_046=changed at depth 946
+setlocal & set DEPTH=947& set DEEP_VAR_047=changed at depth 947
+setlocal & set DEPTH=948& set DEEP_VAR_048=changed at depth 948
+setlocal & set DEPTH=949& set DEEP_VAR_049=changed at depth 949
+setlocal & set DEPTH=950& set DEEP_VAR_050=changed at depth 950
+setlocal & set DEPTH=951& set DEEP_VAR_051=changed at depth 951
+setlocal & set DEPTH=952& set DEEP_VAR_052=changed at depth 952
+setlocal & set DEPTH=953& set DEEP_VAR_053=changed at depth 953
+setlocal & set DEPTH=954& set DEEP_VAR_054=changed at depth 954
+setlocal & set DEPTH=955& set DEEP_VAR_055=changed at depth 955
+setlocal & set DEPTH=956& set DEEP_VAR_056=changed at depth 956
+setlocal & set DEPTH=957& set DEEP_VAR_057=changed at depth 957
+setlocal & set DEPTH=958& set DEEP_VAR_058=changed at depth 958
+setlocal & set DEPTH=959& set DEEP_VAR_059=changed at depth 959
+setlocal & set DEPTH=960& set DEEP_VAR_060=changed at depth 960
+setlocal & set DEPTH=961& set DEEP_VAR_061=changed at depth 961
+setlocal & set DEPTH=962& set DEEP_VAR_062=changed at depth 962
+setlocal & set DEPTH=963& set DEEP_VAR_063=changed at depth 963
+setlocal & set DEPTH=964& set DEEP_VAR_064=changed at depth 964
+setlocal & set DEPTH=965& set DEEP_VAR_065=changed at depth 965
+setlocal & set DEPTH=966& set DEEP_VAR_066=changed at depth 966
+setlocal & set DEPTH=967& set DEEP_VAR_067=changed at depth 967
+setlocal & set DEPTH=968& set DEEP_VAR_068=changed at depth 968
+setlocal & set DEPTH=969& set DEEP_VAR_069=changed at depth 969
+setlocal & set DEPTH=970& set DEEP_VAR_070=changed at depth 970
+setlocal & set DEPTH=971& set DEEP_VAR_071=changed at depth 971
+setlocal & set DEPTH=972& set DEEP_VAR_072=changed at depth 972
+setlocal & set DEPTH=973& set DEEP_VAR_073=changed at depth 973
+setlocal & set DEPTH=974& set DEEP_VAR_074=changed at depth 974
+setlocal & set DEPTH=975& set DEEP_VAR_075=changed at depth 975
+setlocal & set DEPTH=976& set DEEP_VAR_076=changed at depth 976
+setlocal & set DEPTH=977& set DEEP_VAR_077=changed at depth 977
+setlocal & set DEPTH=978& set DEEP_VAR_078=changed at depth 978
+setlocal & set DEPTH=979& set DEEP_VAR_079=changed at depth 979
+setlocal & set DEPTH=980& set DEEP_VAR_080=changed at depth 980
+setlocal & set DEPTH=981& set DEEP_VAR_081=changed at depth 981
+setlocal & set DEPTH=982& set DEEP_VAR_082=changed at depth 982
+setlocal & set DEPTH=983& set DEEP_VAR_083=changed at depth 983
+setlocal & set DEPTH=984& set DEEP_VAR_084=changed at depth 984
+setlocal & set DEPTH=985& set DEEP_VAR_085=changed at depth 985
+setlocal & set DEPTH=986& set DEEP_VAR_086=changed at depth 986
+setlocal & set DEPTH=987& set DEEP_VAR_087=changed at depth 987
+setlocal & set DEPTH=988& set DEEP_VAR_088=changed at depth 988
+setlocal & set DEPTH=989& set DEEP_VAR_089=changed at depth 989
+setlocal & set DEPTH=990& set DEEP_VAR_090=changed at depth 990
+setlocal & set DEPTH=991& set DEEP_VAR_091=changed at depth 991
+setlocal & set DEPTH=992& set DEEP_VAR_092=changed at depth 992
+setlocal & set DEPTH=993& set DEEP_VAR_093=changed at depth 993
+setlocal & set DEPTH=994& set DEEP_VAR_094=changed at depth 994
+setlocal & set DEPTH=995& set DEEP_VAR_095=changed at depth 995
+setlocal & set DEPTH=996& set DEEP_VAR_096=changed at depth 996
+setlocal & set DEPTH=997& set DEEP_VAR_097=changed at depth 997
+setlocal & set DEPTH=998& set DEEP_VAR_098=changed at depth 998
+setlocal & set DEPTH=999& set DEEP_VAR_099=changed at depth 999
+setlocal & set DEPTH=1000& set DEEP_VAR_100=changed at depth 1000
+set DEPTH
+for %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 38 39 40 41 42 43 44 45 46 47 48 49 50 51 52 53 54 55 56 57 58 59 60 61 62 63 64 65 66 67 68 69 70 71 72 73 74 75 76 77 78 79 80 81 82 83 84 85 86 87 88 89 90 91 92 93 94 95 96 97 98 99 100 101 102 103 104 105 106 107 108 109 110 111 112 113 114 115 116 117 118 119 120 121 122 123 124 125 126 127 128 129 130 131 132 133 134 135 136 137 138 139 140 141 142 143 144 145 146 147 148 149 150 151 152 153 154 155 156 157 158 159 160 161 162 163 164 165 166 167 168 169 170 171 172 173 174 175 176 177 178 179 180 181 182 183 184 185 186 187 188 189 190 191 192 193 194 195 196 197 198 199 200 201 202 203 204 205 206 207 208 209 210 211 212 213 214 215 216 217 218 219 220 221 222 223 224 225 226 227 228 229 230 231 232 233 234 235 236 237 238 239 240 241 242 243 244 245 246 247 248 249 250 251 252 253 254 255 256 257 258 259 260 261 262 263 264 265 266 267 268 269 270 271 272 273 274 275 276 277 278 279 280 281 282 283 284 285 286 287 288 289 290 291 292 293 294 295 296 297 298 299 300 301 302 303 304 305 306 307 308 309 310 311 312 313 314 315 316 317 318 319 320 321 322 323 324 325 326 327 328 329 330 331 332 333 334 335 336 337 338 339 340 341 342 343 344 345 346 347 348 349 350 351 352 353 354 355 356 357 358 359 360 361 362 363 364 365 366 367 368 369 370 371 372 373 374 375 376 377 378 379 380 381 382 383 384 385 386 387 388 389 390 391 392 393 394 395 396 397 398 399 400 401 402 403 404 405 406 407 408 409 410 411 412 413 414 415 416 417 418 419 420 421 422 423 424 425 426 427 428 429 430 431 432 433 434 435 436 437 438 439 440 441 442 443 444 445 446 447 448 449 450 451 452 453 454 455 456 457 458 459 460 461 462 463 464 465 466 467 468 469 470 471 472 473 474 475 476 477 478 479 480 481 482 483 484 485 486 487 488 489 490 491 492 493 494 495 496 497 498 499 500 501 502 503 504 505 506 507 508 509 510 511 512 513 514 515 516 517 518 519 520 521 522 523 524 525 526 527 528 529 530 531 532 533 534 535 536 537 538 539 540 541 542 543 544 545 546 547 548 549 550 551 552 553 554 555 556 557 558 559 560 561 562 563 564 565 566 567 568 569 570 571 572 573 574 575 576 577 578 579 580 581 582 583 584 585 586 587 588 589 590 591 592 593 594 595 596 597 598 599 600 601 602 603 604 605 606 607 608 609 610 611 612 613 614 615 616 617 618 619 620 621 622 623 624 625 626 627 628 629 630 631 632 633 634 635 636 637 638 639 640 641 642 643 644 645 646 647 648 649 650 651 652 653 654 655 656 657 658 659 660 661 662 663 664 665 666 667 668 669 670 671 672 673 674 675 676 677 678 679 680 681 682 683 684 685 686 687 688 689 690 691 692 693 694 695 696 697 698 699 700 701 702 703 704 705 706 707 708 709 710 711 712 713 714 715 716 717 718 719 720 721 722 723 724 725 726 727 728 729 730 731 732 733 734 735 736 737 738 739 740 741 742 743 744 745 746 747 748 749 750 751 752 753 754 755 756 757 758 759 760 761 762 763 764 765 766 767 768 769 770 771 772 773 774 775 776 777 778 779 780 781 782 783 784 785 786 787 788 789 790 791 792 793 794 795 796 797 798 799 800 801 802 803 804 805 806 807 808 809 810 811 812 813 814 815 816 817 818 819 820 821 822 823 824 825 826 827 828 829 830 831 832 833 834 835 836 837 838 839 840 841 842 843 844 845 846 847 848 849 850 851 852 853 854 855 856 857 858 859 860 861 862 863 864 865 866 867 868 869 870 871 872 873 874 875 876 877 878 879 880 881 882 883 884 885 886 887 888 889 890 891 892 893 894 895 896 897 898 899 900 901 902 903 904 905 906 907 908 909 910 911 912 913 914 915 916 917 918 919 920 921 922 923 924 925 926 927 928 929 930 931 932 933 934 935 936 937 938 939 940 941 942 943 944 945 946 947 948 949 950 951 952 953 954 955 956 957 958 959 960 961 962 963 964 965 966 967 968 969 970 971 972 973 974 975 976 977 978 979 980 981 982 983 984 985 986 987 988 989 990 991 992 993 994 995 996 997 998 999 1000) do endlocal
+set DEPTH
+endlocal
@@ -0,0 +1,17 @@
+:: Directory listings, with and without hidden entries, and wildcard FOR sets that list
+:: directories themselves.
+dir
+dir dir00
+dir /a dir01
+dir dir02\sub0
+dir C:\corpus\dir03
+for %a in (dir04 dir05 dir06 dir07) do dir %a
+for %a in (dir08 dir09) do for %b in (sub0 sub1 sub2 sub3) do dir %a\%b
+for %a in (dir1*) do echo %a
+for %f in (dir10\*.log) do echo %f
+for %f in (dir11\file1*.txt) do echo %f
+for %f in (dir12\*) do set LAST_FILE=%f
+dir nosuchdir
+dir > nul
+dir dir13 > nul
+dir /a dir14 >> nul
@@ -0,0 +1,407 @@
+:: A long run of ECHO lines: plain text, quoted text, variable expansion and redirection
+:: to NUL, the way generated build scripts log their progress.
+setlocal
+set FLOOD=flood value
+set TARGET=C:\corpus\dir00
+echo alpha alpha mike mike echo bravo alpha
+echo "delta echo lima kilo"
+echo [002] %FLOOD% foxtrot india echo india bravo juliet golf hotel
+echo building %TARGET%\india.obj
+echo lima mike delta india echo charlie hotel lima juliet > nul
+echo lima india charlie alpha juliet golf hotel & echo charlie
+echo %NOT_SET% golf foxtrot mike delta hotel
+echo step 7 of 400: juliet alpha delta kilo india hotel
+echo hotel lima bravo delta echo delta
+echo "charlie bravo lima delta"
+echo [010] %FLOOD% golf lima india alpha juliet golf foxtrot
+echo building %TARGET%\delta.obj
+echo lima lima foxtrot charlie mike > nul
+echo mike charlie india kilo & echo bravo
+echo %NOT_SET% mike echo echo echo alpha india echo lima india
+echo step 15 of 400: echo alpha
+echo lima bravo golf kilo bravo echo golf golf charlie
+echo "foxtrot delta charlie echo hotel golf"
+echo [018] %FLOOD% kilo mike charlie
+echo building %TARGET%\echo.obj
+echo india hotel alpha juliet charlie golf > nul
+echo kilo alpha foxtrot & echo delta
+echo %NOT_SET% delta foxtrot bravo golf foxtrot charlie foxtrot foxtrot echo
+echo step 23 of 400: hotel juliet golf
+echo kilo golf golf bravo charlie india india juliet
+echo "charlie kilo alpha bravo lima juliet lima"
+echo [026] %FLOOD% bravo lima kilo kilo charlie kilo
+echo building %TARGET%\india.obj
+echo alpha india > nul
+echo bravo golf golf juliet kilo kilo charlie golf & echo bravo
+echo %NOT_SET% delta lima kilo golf lima alpha lima delta alpha
+echo step 31 of 400: charlie golf lima hotel
+echo echo india charlie kilo bravo lima lima india
+echo "foxtrot lima mike alpha golf juliet juliet charlie"
+echo [034] %FLOOD% kilo foxtrot
+echo building %TARGET%\mike.obj
+echo bravo golf delta bravo lima echo charlie alpha delta > nul
+echo lima foxtrot echo foxtrot & echo golf
+echo %NOT_SET% india lima alpha echo golf hotel
+echo step 39 of 400: mike charlie golf bravo hotel india india lima
+echo lima juliet
+echo "alpha charlie charlie hotel hotel lima delta"
+echo [042] %FLOOD% lima charlie india bravo charlie india juliet
+echo building %TARGET%\lima.obj
+echo kilo golf lima > nul
+echo charlie golf echo india bravo hotel echo & echo echo
+echo %NOT_SET% kilo bravo foxtrot kilo alpha lima mike
+echo step 47 of 400: bravo delta lima
+echo hotel foxtrot foxtrot bravo india echo mike echo mike
+echo "foxtrot kilo delta alpha hotel kilo alpha"
+echo [050] %FLOOD% charlie lima charlie bravo golf delta hotel bravo hotel
+echo building %TARGET%\alpha.obj
+echo alpha foxtrot echo alpha mike > nul
+echo lima mike golf foxtrot mike & echo mike
+echo %NOT_SET% kilo bravo bravo echo bravo golf
+echo step 55 of 400: echo delta hotel alpha mike lima juliet echo charlie
+echo delta india juliet
+echo "juliet charlie alpha"
+echo [058] %FLOOD% kilo golf juliet juliet foxtrot echo foxtrot foxtrot bravo
+echo building %TARGET%\delta.obj
+echo alpha lima > nul
+echo foxtrot alpha alpha alpha & echo india
+echo %NOT_SET% delta hotel charlie charlie charlie kilo bravo hotel
+echo step 63 of 400: alpha lima delta kilo alpha india lima bravo foxtrot
+echo echo kilo echo kilo juliet hotel mike foxtrot delta
+echo "delta foxtrot delta foxtrot kilo bravo lima charlie lima"
+echo [066] %FLOOD% foxtrot foxtrot juliet mike mike bravo india
+echo building %TARGET%\india.obj
+echo juliet juliet hotel foxtrot mike foxtrot mike golf > nul
+echo bravo india india charlie delta golf echo & echo kilo
+echo %NOT_SET% echo india india delta charlie mike foxtrot hotel mike
+echo step 71 of 400: alpha golf
+echo juliet kilo bravo charlie india
+echo "hotel lima foxtrot"
+echo [074] %FLOOD% lima golf mike hotel delta bravo lima
+echo building %TARGET%\juliet.obj
+echo delta juliet india lima mike charlie > nul
+echo delta lima lima hotel juliet juliet hotel mike & echo golf
+echo %NOT_SET% golf foxtrot
+echo step 79 of 400: golf delta
+echo hotel mike hotel hotel
+echo "india bravo foxtrot echo foxtrot india lima alpha"
+echo [082] %FLOOD% delta charlie mike alpha hotel
+echo building %TARGET%\golf.obj
+echo juliet charlie kilo kilo echo > nul
+echo kilo india kilo india delta bravo echo & echo charlie
+echo %NOT_SET% bravo delta bravo juliet echo
+echo step 87 of 400: mike bravo lima bravo golf delta golf
+echo echo lima hotel juliet bravo charlie
+echo "alpha delta golf hotel alpha lima alpha"
+echo [090] %FLOOD% bravo delta charlie kilo kilo lima lima delta alpha
+echo building %TARGET%\bravo.obj
+echo foxtrot delta bravo foxtrot kilo alpha kilo hotel > nul
+echo foxtrot golf lima echo india golf juliet & echo kilo
+echo %NOT_SET% delta golf
+echo step 95 of 400: mike echo golf mike golf kilo delta
+echo foxtrot lima hotel mike mike juliet alpha mike
+echo "mike india lima mike delta foxtrot"
+echo [098] %FLOOD% alpha lima golf
+echo building %TARGET%\delta.obj
+echo juliet alpha alpha > nul
+echo echo lima kilo india & echo delta
+echo %NOT_SET% golf juliet bravo
+echo step 103 of 400: echo kilo kilo
+echo lima golf india kilo lima delta kilo echo
+echo "india lima lima delta juliet charlie lima"
+echo [106] %FLOOD% foxtrot alpha hotel bravo
+echo building %TARGET%\echo.obj
+echo alpha juliet india > nul
+echo foxtrot golf & echo mike
+echo %NOT_SET% juliet alpha golf foxtrot kilo
+echo step 111 of 400: delta bravo delta golf bravo juliet hotel delta
+echo echo hotel echo
+echo "echo kilo delta kilo juliet hotel golf"
+echo [114] %FLOOD% juliet golf mike charlie foxtrot
+echo building %TARGET%\foxtrot.obj
+echo india hotel juliet echo charlie foxtrot > nul
+echo lima juliet & echo lima
+echo %NOT_SET% mike echo foxtrot alpha bravo juliet
+echo step 119 of 400: india hotel golf foxtrot bravo kilo golf echo
+echo delta juliet india alpha hotel kilo lima
+echo "golf charlie juliet"
+echo [122] %FLOOD% india bravo hotel juliet
+echo building %TARGET%\golf.obj
+echo charlie mike lima lima > nul
+echo mike hotel hotel lima hotel mike delta hotel india & echo hotel
+echo %NOT_SET% delta charlie
+echo step 127 of 400: bravo foxtrot lima mike hotel india golf echo golf
+echo lima echo
+echo "delta golf lima delta alpha india hotel bravo golf"
+echo [130] %FLOOD% bravo hotel alpha echo golf juliet kilo
+echo building %TARGET%\india.obj
+echo bravo bravo echo lima india kilo golf india > nul
+echo charlie hotel & echo bravo
+echo %NOT_SET% delta juliet echo charlie
+echo step 135 of 400: hotel hotel hotel golf echo hotel alpha hotel
+echo india juliet kilo lima foxtrot juliet bravo hotel echo
+echo "india kilo delta"
+echo [138] %FLOOD% foxtrot golf india juliet bravo alpha kilo
+echo building %TARGET%\mike.obj
+echo delta bravo golf > nul
+echo alpha juliet bravo & echo echo
+echo %NOT_SET% lima echo juliet charlie india
+echo step 143 of 400: hotel india kilo charlie charlie golf echo
+echo bravo delta india juliet kilo delta alpha
+echo "charlie golf"
+echo [146] %FLOOD% echo foxtrot lima golf alpha echo
+echo building %TARGET%\delta.obj
+echo hotel kilo alpha bravo > nul
+echo alpha golf echo delta delta alpha foxtrot mike & echo kilo
+echo %NOT_SET% mike lima foxtrot juliet
+echo step 151 of 400: echo lima charlie hotel alpha charlie mike foxtrot
+echo charlie hotel kilo
+echo "india mike"
+echo [154] %FLOOD% foxtrot bravo alpha bravo lima charlie bravo
+echo building %TARGET%\charlie.obj
+echo charlie lima > nul
+echo kilo juliet juliet hotel & echo delta
+echo %NOT_SET% golf golf kilo alpha hotel kilo
+echo step 159 of 400: echo delta juliet mike echo alpha echo kilo kilo
+echo juliet charlie golf delta bravo foxtrot delta bravo
+echo "alpha alpha india"
+echo [162] %FLOOD% delta alpha juliet juliet echo foxtrot
+echo building %TARGET%\lima.obj
+echo echo kilo > nul
+echo juliet india hotel echo hotel hotel kilo delta delta & echo bravo
+echo %NOT_SET% bravo india bravo golf alpha charlie
+echo step 167 of 400: alpha india delta delta foxtrot charlie
+echo echo kilo charlie
+echo "golf delta"
+echo [170] %FLOOD% india kilo india juliet hotel bravo alpha alpha bravo
+echo building %TARGET%\golf.obj
+echo delta golf charlie mike hotel charlie kilo mike > nul
+echo echo echo kilo lima alpha & echo foxtrot
+echo %NOT_SET% lima charlie mike alpha alpha
+echo step 175 of 400: kilo india alpha
+echo alpha delta
+echo "mike charlie lima mike golf hotel"
+echo [178] %FLOOD% bravo bravo alpha
+echo building %TARGET%\charlie.obj
+echo juliet bravo kilo alpha mike echo > nul
+echo hotel charlie lima hotel golf bravo hotel kilo delta & echo delta
+echo %NOT_SET% echo foxtrot juliet foxtrot alpha
+echo step 183 of 400: charlie echo charlie bravo india india bravo delta foxtrot
+echo golf echo
+echo "foxtrot golf mike kilo"
+echo [186] %FLOOD% hotel kilo india hotel foxtrot lima juliet hotel india
+echo building %TARGET%\alpha.obj
+echo india kilo golf lima golf lima juliet hotel > nul
+echo foxtrot mike lima bravo alpha lima & echo juliet
+echo %NOT_SET% charlie delta
+echo step 191 of 400: india charlie bravo
+echo bravo foxtrot
+echo "lima foxtrot bravo mike lima echo"
+echo [194] %FLOOD% hotel golf lima delta delta
+echo building %TARGET%\india.obj
+echo delta echo > nul
+echo juliet delta alpha golf bravo alpha kilo & echo alpha
+echo %NOT_SET% bravo delta
+echo step 199 of 400: charlie echo
+echo bravo kilo alpha
+echo "delta echo kilo"
+echo [202] %FLOOD% bravo alpha mike golf juliet
+echo building %TARGET%\mike.obj
+echo foxtrot bravo hotel > nul
+echo india mike juliet delta foxtrot alpha charlie & echo juliet
+echo %NOT_SET% bravo delta
+echo step 207 of 400: charlie india hotel delta hotel hotel alpha
+echo delta echo delta golf mike kilo lima delta foxtrot
+echo "juliet golf echo echo"
+echo [210] %FLOOD% india lima delta charlie india india echo
+echo building %TARGET%\hotel.obj
+echo bravo kilo > nul
+echo juliet mike lima & echo mike
+echo %NOT_SET% kilo india mike juliet charlie hotel alpha lima juliet
+echo step 215 of 400: alpha echo juliet india juliet
+echo charlie hotel alpha lima kilo
+echo "lima hotel charlie charlie bravo"
+echo [218] %FLOOD% kilo echo hotel foxtrot mike juliet foxtrot bravo hotel
+echo building %TARGET%\bravo.obj
+echo bravo juliet juliet delta foxtrot juliet bravo > nul
+echo bravo juliet foxtrot hotel & echo juliet
+echo %NOT_SET% golf golf echo
+echo step 223 of 400: bravo bravo charlie mike hotel golf bravo lima golf
+echo mike delta foxtrot
+echo "hotel bravo bravo charlie charlie hotel echo foxtrot"
+echo [226] %FLOOD% lima mike india hotel
+echo building %TARGET%\mike.obj
+echo golf alpha > nul
+echo lima hotel & echo india
+echo %NOT_SET% mike hotel hotel kilo juliet mike india bravo
+echo step 231 of 400: bravo golf delta juliet delta foxtrot kilo
+echo kilo foxtrot
+echo "juliet hotel golf echo charlie"
+echo [234] %FLOOD% foxtrot alpha hotel bravo alpha juliet foxtrot
+echo building %TARGET%\india.obj
+echo india juliet foxtrot delta > nul
+echo india juliet golf bravo charlie mike golf & echo foxtrot
+echo %NOT_SET% kilo bravo foxtrot hotel
+echo step 239 of 400: charlie alpha juliet bravo hotel
+echo lima lima india
+echo "foxtrot juliet"
+echo [242] %FLOOD% delta kilo alpha
+echo building %TARGET%\echo.obj
+echo delta foxtrot foxtrot delta > nul
+echo kilo kilo delta hotel charlie & echo hotel
+echo %NOT_SET% kilo echo bravo
+echo step 247 of 400: juliet foxtrot foxtrot charlie bravo mike
+echo hotel bravo juliet lima india alpha charlie india india
+echo "kilo mike charlie delta mike charlie bravo charlie alpha"
+echo [250] %FLOOD% foxtrot kilo juliet
+echo building %TARGET%\alpha.obj
+echo bravo india hotel india > nul
+echo delta golf & echo alpha
+echo %NOT_SET% bravo india lima lima alpha lima india juliet golf
+echo step 255 of 400: golf mike
+echo juliet lima lima juliet lima charlie
+echo "foxtrot lima delta bravo"
+echo [258] %FLOOD% hotel kilo hotel golf lima juliet kilo
+echo building %TARGET%\lima.obj
+echo juliet kilo lima > nul
+echo bravo foxtrot juliet delta juliet hotel kilo echo juliet & echo delta
+echo %NOT_SET% alpha alpha echo delta
+echo step 263 of 400: delta echo delta india golf
+echo india juliet golf juliet charlie lima alpha hotel mike
+echo "delta india foxtrot hotel alpha delta alpha"
+echo [266] %FLOOD% delta hotel juliet delta
+echo building %TARGET%\india.obj
+echo foxtrot kilo bravo bravo > nul
+echo juliet golf india echo mike mike & echo echo
+echo %NOT_SET% charlie juliet hotel
+echo step 271 of 400: mike kilo india bravo lima bravo bravo
+echo foxtrot hotel
+echo "alpha juliet lima kilo lima"
+echo [274] %FLOOD% delta foxtrot lima echo alpha juliet echo golf delta
+echo building %TARGET%\alpha.obj
+echo alpha mike charlie hotel india > nul
+echo charlie delta lima delta mike & echo juliet
+echo %NOT_SET% alpha india alpha mike alpha hotel charlie
+echo step 279 of 400: golf foxtrot delta
+echo bravo mike hotel
+echo "charlie bravo lima alpha golf"
+echo [282] %FLOOD% foxtrot foxtrot lima
+echo building %TARGET%\charlie.obj
+echo echo hotel kilo juliet charlie echo lima juliet charlie > nul
+echo charlie bravo alpha bravo mike & echo delta
+echo %NOT_SET% juliet golf bravo golf bravo echo mike india
+echo step 287 of 400: foxtrot delta hotel charlie golf
+echo foxtrot foxtrot mike mike charlie
+echo "kilo lima kilo delta echo mike"
+echo [290] %FLOOD% foxtrot lima charlie charlie india charlie lima
+echo building %TARGET%\bravo.obj
+echo golf echo kilo alpha > nul
+echo echo mike & echo delta
+echo %NOT_SET% delta india juliet charlie kilo golf bravo
+echo step 295 of 400: delta lima mike echo golf
+echo mike lima hotel lima india juliet kilo juliet
+echo "charlie golf hotel"
+echo [298] %FLOOD% kilo golf juliet india
+echo building %TARGET%\delta.obj
+echo charlie mike mike foxtrot lima > nul
+echo echo charlie alpha mike echo & echo charlie
+echo %NOT_SET% bravo hotel lima lima
+echo step 303 of 400: india charlie
+echo golf delta kilo foxtrot mike bravo hotel charlie alpha
+echo "delta charlie"
+echo [306] %FLOOD% india lima
+echo building %TARGET%\kilo.obj
+echo delta lima charlie alpha charlie charlie > nul
+echo delta delta & echo kilo
+echo %NOT_SET% bravo bravo echo echo
+echo step 311 of 400: india charlie juliet
+echo foxtrot india charlie kilo hotel india lima mike delta
+echo "alpha bravo juliet kilo charlie"
+echo [314] %FLOOD% kilo delta delta foxtrot charlie
+echo building %TARGET%\alpha.obj
+echo foxtrot hotel kilo hotel india echo > nul
+echo juliet delta foxtrot echo lima kilo & echo mike
+echo %NOT_SET% kilo charlie hotel charlie alpha foxtrot alpha
+echo step 319 of 400: india hotel alpha
+echo golf delta delta
+echo "alpha lima bravo delta juliet"
+echo [322] %FLOOD% hotel echo foxtrot kilo
+echo building %TARGET%\kilo.obj
+echo alpha lima foxtrot bravo delta bravo > nul
+echo foxtrot foxtrot foxtrot mike lima india golf juliet & echo kilo
+echo %NOT_SET% bravo hotel hotel echo delta
+echo step 327 of 400: bravo lima hotel delta golf hotel
+echo juliet charlie echo
+echo "echo foxtrot golf bravo mike hotel bravo charlie"
+echo [330] %FLOOD% bravo kilo
+echo building %TARGET%\golf.obj
+echo juliet foxtrot charlie > nul
+echo kilo kilo kilo echo charlie echo echo & echo bravo
+echo %NOT_SET% mike kilo juliet hotel hotel mike delta charlie
+echo step 335 of 400: delta alpha mike charlie kilo kilo echo mike alpha
+echo kilo mike mike mike alpha kilo
+echo "juliet hotel charlie india delta hotel bravo"
+echo [338] %FLOOD% mike mike charlie foxtrot alpha delta echo hotel kilo
+echo building %TARGET%\golf.obj
+echo golf foxtrot india charlie golf alpha charlie kilo > nul
+echo golf juliet charlie delta bravo hotel charlie hotel foxtrot & echo mike
+echo %NOT_SET% delta kilo echo india foxtrot india
+echo step 343 of 400: juliet kilo delta foxtrot hotel alpha india alpha
+echo charlie foxtrot juliet
+echo "lima foxtrot echo hotel foxtrot alpha alpha"
+echo [346] %FLOOD% lima kilo foxtrot golf kilo india alpha india
+echo building %TARGET%\golf.obj
+echo foxtrot juliet kilo lima juliet hotel foxtrot > nul
+echo kilo bravo golf & echo delta
+echo %NOT_SET% alpha bravo mike golf mike delta
+echo step 351 of 400: delta juliet echo bravo bravo delta alpha
+echo mike hotel
+echo "india golf echo hotel delta"
+echo [354] %FLOOD% bravo lima juliet alpha charlie charlie mike delta golf
+echo building %TARGET%\foxtrot.obj
+echo echo foxtrot hotel golf > nul
+echo echo alpha charlie golf alpha mike delta charlie echo & echo bravo
+echo %NOT_SET% india juliet echo charlie
+echo step 359 of 400: kilo bravo foxtrot juliet
+echo india kilo
+echo "echo lima mike delta hotel india hotel"
+echo [362] %FLOOD% kilo juliet bravo lima alpha charlie hotel
+echo building %TARGET%\india.obj
+echo delta alpha alpha hotel > nul
+echo alpha delta kilo hotel kilo mike bravo hotel & echo golf
+echo %NOT_SET% charlie foxtrot echo india bravo lima juliet kilo
+echo step 367 of 400: echo india juliet india
+echo bravo alpha juliet india echo alpha lima lima alpha
+echo "lima delta lima bravo mike echo mike golf"
+echo [370] %FLOOD% lima hotel golf lima bravo golf juliet foxtrot
+echo building %TARGET%\lima.obj
+echo bravo alpha kilo juliet > nul
+echo alpha bravo bravo lima echo india delta golf juliet & echo alpha
+echo %NOT_SET% alpha mike echo kilo
+echo step 375 of 400: alpha bravo mike bravo foxtrot bravo echo
+echo hotel kilo bravo
+echo "juliet golf hotel delta lima india india hotel"
+echo [378] %FLOOD% india echo india golf
+echo building %TARGET%\mike.obj
+echo alpha charlie golf india golf kilo > nul
+echo alpha bravo lima foxtrot juliet hotel delta delta & echo kilo
+echo %NOT_SET% charlie charlie juliet delta foxtrot charlie
+echo step 383 of 400: alpha kilo alpha delta bravo echo
+echo lima foxtrot hotel delta juliet
+echo "golf juliet echo foxtrot"
+echo [386] %FLOOD% delta golf bravo bravo
+echo building %TARGET%\lima.obj
+echo alpha foxtrot > nul
+echo mike juliet delta hotel charlie delta & echo india
+echo %NOT_SET% echo foxtrot foxtrot hotel echo alpha
+echo step 391 of 400: alpha hotel foxtrot golf alpha
+echo bravo echo india kilo bravo alpha golf foxtrot
+echo "juliet bravo delta foxtrot bravo alpha"
+echo [394] %FLOOD% juliet lima delta echo bravo
+echo building %TARGET%\echo.obj
+echo delta bravo > nul
+echo delta delta delta & echo alpha
+echo %NOT_SET% kilo delta
+echo step 399 of 400: mike mike hotel india alpha echo
+for %a in (1 2 3 4 5 6 7 8 9 10) do for %b in (1 2 3 4 5 6 7 8 9 10) do echo line %a.%b
+endlocal
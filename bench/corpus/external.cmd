@@ -0,0 +1,20 @@
+:: External programs: plain calls, exit codes feeding && and ||, redirection, pipes into
+:: builtins and other programs, and parallel loops starting one process per iteration.
+standin hello from the corpus
+standin lines=20 > nul
+standin lines=2000 > nul
+standin lines=200 width=120 > nul
+standin exit=0 && echo ok
+standin exit=3 || echo failed with %ERRORLEVEL%
+standin exit=1 && echo unreachable
+standin lines=500 | sort > nul
+standin lines=500 | sort /R > nul
+standin lines=2000 | standin stdin
+echo piped into a program | standin stdin
+dir dir00 | standin stdin
+for %a in (1 2 3 4 5 6 7 8) do standin lines=%a0 > nul
+for /J:4 %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16) do standin lines=%a00
+standin lines=50 2> nul > nul
+standin lines=50 > nul 2>&1
+(standin first & standin second) > nul
+nosuchprogram
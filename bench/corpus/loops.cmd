@@ -0,0 +1,27 @@
+:: FOR loops over literal sets: SET in loop bodies, nested loops, multi-line blocks and
+:: conditional chains inside the body.
+setlocal
+for %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20) do set LOOP_%a=value %a
+for %a in (a b c d e f g h) do for %b in (1 2 3 4 5 6 7 8) do set PAIR=%a%b
+for %a in (a b c d e f g h) do for %b in (1 2 3 4 5 6 7 8) do echo %a-%b
+for %a in (1 2 3 4 5 6 7 8 9 10) do (
+    set STEP=%a
+    echo step %a
+    echo %STEP% done
+)
+for %a in (red green blue cyan magenta yellow black white) do (
+    set COLOR=%a
+    set %a_SEEN=yes && echo seen %a || echo failed %a
+)
+for %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16) do (
+    for %b in (x y z) do (
+        set CELL_%a_%b=%a%b
+    )
+)
+for %a in ("first item" "second item" "third item") do echo %a
+for %a in (one;two;three,four,five six) do set LAST=%a
+for /J:4 %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16) do echo parallel %a
+for /J %a in (a b c d e f g h) do for %b in (1 2 3 4) do echo %a%b
+set LOOP_1
+set CELL_
+endlocal
@@ -0,0 +1,10 @@
+:: Large builtin output redirected to a file and written behind by the stream's writer thread.
+:: The output goes to a file in TEMP, since redirection bypasses the in-memory tree.
+setlocal
+set OPENCMD_WRITE_BEHIND=1
+(for %a in (dir00 dir01 dir02 dir03 dir04 dir05 dir06 dir07 dir08 dir09 dir10 dir11 dir12 dir13 dir14 dir15) do for %b in (1 2 3 4) do dir /a %a) > %TEMP%\opencmd-replay-redirect.txt
+for %a in (dir00 dir01 dir02 dir03 dir04 dir05 dir06 dir07 dir08 dir09 dir10 dir11 dir12 dir13 dir14 dir15) do dir %a >> %TEMP%\opencmd-replay-redirect.txt
+standin lines=50000 | sort > %TEMP%\opencmd-replay-redirect.txt
+standin lines=50000 | sort /O %TEMP%\opencmd-replay-redirect.txt
+(for %a in (1 2 3 4 5 6 7 8 9 10) do for %b in (1 2 3 4 5 6 7 8 9 10) do echo line %a.%b of the redirect corpus) > %TEMP%\opencmd-replay-redirect.txt
+endlocal
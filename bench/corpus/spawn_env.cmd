@@ -0,0 +1,507 @@
+:: Program starts with 500 variables defined. The first start after the SETs builds the
+:: environment block; the ones after it reuse the block, and a SET between two starts patches
+:: only its own entry.
+setlocal
+set SPAWN_VAR_001=value 001 of the spawn corpus
+set SPAWN_VAR_002=value 002 of the spawn corpus
+set SPAWN_VAR_003=value 003 of the spawn corpus
+set SPAWN_VAR_004=value 004 of the spawn corpus
+set SPAWN_VAR_005=value 005 of the spawn corpus
+set SPAWN_VAR_006=value 006 of the spawn corpus
+set SPAWN_VAR_007=value 007 of the spawn corpus
+set SPAWN_VAR_008=value 008 of the spawn corpus
+set SPAWN_VAR_009=value 009 of the spawn corpus
+set SPAWN_VAR_010=value 010 of the spawn corpus
+set SPAWN_VAR_011=value 011 of the spawn corpus
+set SPAWN_VAR_012=value 012 of the spawn corpus
+set SPAWN_VAR_013=value 013 of the spawn corpus
+set SPAWN_VAR_014=value 014 of the spawn corpus
+set SPAWN_VAR_015=value 015 of the spawn corpus
+set SPAWN_VAR_016=value 016 of the spawn corpus
+set SPAWN_VAR_017=value 017 of the spawn corpus
+set SPAWN_VAR_018=value 018 of the spawn corpus
+set SPAWN_VAR_019=value 019 of the spawn corpus
+set SPAWN_VAR_020=value 020 of the spawn corpus
+set SPAWN_VAR_021=value 021 of the spawn corpus
+set SPAWN_VAR_022=value 022 of the spawn corpus
+set SPAWN_VAR_023=value 023 of the spawn corpus
+set SPAWN_VAR_024=value 024 of the spawn corpus
+set SPAWN_VAR_025=value 025 of the spawn corpus
+set SPAWN_VAR_026=value 026 of the spawn corpus
+set SPAWN_VAR_027=value 027 of the spawn corpus
+set SPAWN_VAR_028=value 028 of the spawn corpus
+set SPAWN_VAR_029=value 029 of the spawn corpus
+set SPAWN_VAR_030=value 030 of the spawn corpus
+set SPAWN_VAR_031=value 031 of the spawn corpus
+set SPAWN_VAR_032=value 032 of the spawn corpus
+set SPAWN_VAR_033=value 033 of the spawn corpus
+set SPAWN_VAR_034=value 034 of the spawn corpus
+set SPAWN_VAR_035=value 035 of the spawn corpus
+set SPAWN_VAR_036=value 036 of the spawn corpus
+set SPAWN_VAR_037=value 037 of the spawn corpus
+set SPAWN_VAR_038=value 038 of the spawn corpus
+set SPAWN_VAR_039=value 039 of the spawn corpus
+set SPAWN_VAR_040=value 040 of the spawn corpus
+set SPAWN_VAR_041=value 041 of the spawn corpus
+set SPAWN_VAR_042=value 042 of the spawn corpus
+set SPAWN_VAR_043=value 043 of the spawn corpus
+set SPAWN_VAR_044=value 044 of the spawn corpus
+set SPAWN_VAR_045=value 045 of the spawn corpus
+set SPAWN_VAR_046=value 046 of the spawn corpus
+set SPAWN_VAR_047=value 047 of the spawn corpus
+set SPAWN_VAR_048=value 048 of the spawn corpus
+set SPAWN_VAR_049=value 049 of the spawn corpus
+set SPAWN_VAR_050=value 050 of the spawn corpus
+set SPAWN_VAR_051=value 051 of the spawn corpus
+set SPAWN_VAR_052=value 052 of the spawn corpus
+set SPAWN_VAR_053=value 053 of the spawn corpus
+set SPAWN_VAR_054=value 054 of the spawn corpus
+set SPAWN_VAR_055=value 055 of the spawn corpus
+set SPAWN_VAR_056=value 056 of the spawn corpus
+set SPAWN_VAR_057=value 057 of the spawn corpus
+set SPAWN_VAR_058=value 058 of the spawn corpus
+set SPAWN_VAR_059=value 059 of the spawn corpus
+set SPAWN_VAR_060=value 060 of the spawn corpus
+set SPAWN_VAR_061=value 061 of the spawn corpus
+set SPAWN_VAR_062=value 062 of the spawn corpus
+set SPAWN_VAR_063=value 063 of the spawn corpus
+set SPAWN_VAR_064=value 064 of the spawn corpus
+set SPAWN_VAR_065=value 065 of the spawn corpus
+set SPAWN_VAR_066=value 066 of the spawn corpus
+set SPAWN_VAR_067=value 067 of the spawn corpus
+set SPAWN_VAR_068=value 068 of the spawn corpus
+set SPAWN_VAR_069=value 069 of the spawn corpus
+set SPAWN_VAR_070=value 070 of the spawn corpus
+set SPAWN_VAR_071=value 071 of the spawn corpus
+set SPAWN_VAR_072=value 072 of the spawn corpus
+set SPAWN_VAR_073=value 073 of the spawn corpus
+set SPAWN_VAR_074=value 074 of the spawn corpus
+set SPAWN_VAR_075=value 075 of the spawn corpus
+set SPAWN_VAR_076=value 076 of the spawn corpus
+set SPAWN_VAR_077=value 077 of the spawn corpus
+set SPAWN_VAR_078=value 078 of the spawn corpus
+set SPAWN_VAR_079=value 079 of the spawn corpus
+set SPAWN_VAR_080=value 080 of the spawn corpus
+set SPAWN_VAR_081=value 081 of the spawn corpus
+set SPAWN_VAR_082=value 082 of the spawn corpus
+set SPAWN_VAR_083=value 083 of the spawn corpus
+set SPAWN_VAR_084=value 084 of the spawn corpus
+set SPAWN_VAR_085=value 085 of the spawn corpus
+set SPAWN_VAR_086=value 086 of the spawn corpus
+set SPAWN_VAR_087=value 087 of the spawn corpus
+set SPAWN_VAR_088=value 088 of the spawn corpus
+set SPAWN_VAR_089=value 089 of the spawn corpus
+set SPAWN_VAR_090=value 090 of the spawn corpus
+set SPAWN_VAR_091=value 091 of the spawn corpus
+set SPAWN_VAR_092=value 092 of the spawn corpus
+set SPAWN_VAR_093=value 093 of the spawn corpus
+set SPAWN_VAR_094=value 094 of the spawn corpus
+set SPAWN_VAR_095=value 095 of the spawn corpus
+set SPAWN_VAR_096=value 096 of the spawn corpus
+set SPAWN_VAR_097=value 097 of the spawn corpus
+set SPAWN_VAR_098=value 098 of the spawn corpus
+set SPAWN_VAR_099=value 099 of the spawn corpus
+set SPAWN_VAR_100=value 100 of the spawn corpus
+set SPAWN_VAR_101=value 101 of the spawn corpus
+set SPAWN_VAR_102=value 102 of the spawn corpus
+set SPAWN_VAR_103=value 103 of the spawn corpus
+set SPAWN_VAR_104=value 104 of the spawn corpus
+set SPAWN_VAR_105=value 105 of the spawn corpus
+set SPAWN_VAR_106=value 106 of the spawn corpus
+set SPAWN_VAR_107=value 107 of the spawn corpus
+set SPAWN_VAR_108=value 108 of the spawn corpus
+set SPAWN_VAR_109=value 109 of the spawn corpus
+set SPAWN_VAR_110=value 110 of the spawn corpus
+set SPAWN_VAR_111=value 111 of the spawn corpus
+set SPAWN_VAR_112=value 112 of the spawn corpus
+set SPAWN_VAR_113=value 113 of the spawn corpus
+set SPAWN_VAR_114=value 114 of the spawn corpus
+set SPAWN_VAR_115=value 115 of the spawn corpus
+set SPAWN_VAR_116=value 116 of the spawn corpus
+set SPAWN_VAR_117=value 117 of the spawn corpus
+set SPAWN_VAR_118=value 118 of the spawn corpus
+set SPAWN_VAR_119=value 119 of the spawn corpus
+set SPAWN_VAR_120=value 120 of the spawn corpus
+set SPAWN_VAR_121=value 121 of the spawn corpus
+set SPAWN_VAR_122=value 122 of the spawn corpus
+set SPAWN_VAR_123=value 123 of the spawn corpus
+set SPAWN_VAR_124=value 124 of the spawn corpus
+set SPAWN_VAR_125=value 125 of the spawn corpus
+set SPAWN_VAR_126=value 126 of the spawn corpus
+set SPAWN_VAR_127=value 127 of the spawn corpus
+set SPAWN_VAR_128=value 128 of the spawn corpus
+set SPAWN_VAR_129=value 129 of the spawn corpus
+set SPAWN_VAR_130=value 130 of the spawn corpus
+set SPAWN_VAR_131=value 131 of the spawn corpus
+set SPAWN_VAR_132=value 132 of the spawn corpus
+set SPAWN_VAR_133=value 133 of the spawn corpus
+set SPAWN_VAR_134=value 134 of the spawn corpus
+set SPAWN_VAR_135=value 135 of the spawn corpus
+set SPAWN_VAR_136=value 136 of the spawn corpus
+set SPAWN_VAR_137=value 137 of the spawn corpus
+set SPAWN_VAR_138=value 138 of the spawn corpus
+set SPAWN_VAR_139=value 139 of the spawn corpus
+set SPAWN_VAR_140=value 140 of the spawn corpus
+set SPAWN_VAR_141=value 141 of the spawn corpus
+set SPAWN_VAR_142=value 142 of the spawn corpus
+set SPAWN_VAR_143=value 143 of the spawn corpus
+set SPAWN_VAR_144=value 144 of the spawn corpus
+set SPAWN_VAR_145=value 145 of the spawn corpus
+set SPAWN_VAR_146=value 146 of the spawn corpus
+set SPAWN_VAR_147=value 147 of the spawn corpus
+set SPAWN_VAR_148=value 148 of the spawn corpus
+set SPAWN_VAR_149=value 149 of the spawn corpus
+set SPAWN_VAR_150=value 150 of the spawn corpus
+set SPAWN_VAR_151=value 151 of the spawn corpus
+set SPAWN_VAR_152=value 152 of the spawn corpus
+set SPAWN_VAR_153=value 153 of the spawn corpus
+set SPAWN_VAR_154=value 154 of the spawn corpus
+set SPAWN_VAR_155=value 155 of the spawn corpus
+set SPAWN_VAR_156=value 156 of the spawn corpus
+set SPAWN_VAR_157=value 157 of the spawn corpus
+set SPAWN_VAR_158=value 158 of the spawn corpus
+set SPAWN_VAR_159=value 159 of the spawn corpus
+set SPAWN_VAR_160=value 160 of the spawn corpus
+set SPAWN_VAR_161=value 161 of the spawn corpus
+set SPAWN_VAR_162=value 162 of the spawn corpus
+set SPAWN_VAR_163=value 163 of the spawn corpus
+set SPAWN_VAR_164=value 164 of the spawn corpus
+set SPAWN_VAR_165=value 165 of the spawn corpus
+set SPAWN_VAR_166=value 166 of the spawn corpus
+set SPAWN_VAR_167=value 167 of the spawn corpus
+set SPAWN_VAR_168=value 168 of the spawn corpus
+set SPAWN_VAR_169=value 169 of the spawn corpus
+set SPAWN_VAR_170=value 170 of the spawn corpus
+set SPAWN_VAR_171=value 171 of the spawn corpus
+set SPAWN_VAR_172=value 172 of the spawn corpus
+set SPAWN_VAR_173=value 173 of the spawn corpus
+set SPAWN_VAR_174=value 174 of the spawn corpus
+set SPAWN_VAR_175=value 175 of the spawn corpus
+set SPAWN_VAR_176=value 176 of the spawn corpus
+set SPAWN_VAR_177=value 177 of the spawn corpus
+set SPAWN_VAR_178=value 178 of the spawn corpus
+set SPAWN_VAR_179=value 179 of the spawn corpus
+set SPAWN_VAR_180=value 180 of the spawn corpus
+set SPAWN_VAR_181=value 181 of the spawn corpus
+set SPAWN_VAR_182=value 182 of the spawn corpus
+set SPAWN_VAR_183=value 183 of the spawn corpus
+set SPAWN_VAR_184=value 184 of the spawn corpus
+set SPAWN_VAR_185=value 185 of the spawn corpus
+set SPAWN_VAR_186=value 186 of the spawn corpus
+set SPAWN_VAR_187=value 187 of the spawn corpus
+set SPAWN_VAR_188=value 188 of the spawn corpus
+set SPAWN_VAR_189=value 189 of the spawn corpus
+set SPAWN_VAR_190=value 190 of the spawn corpus
+set SPAWN_VAR_191=value 191 of the spawn corpus
+set SPAWN_VAR_192=value 192 of the spawn corpus
+set SPAWN_VAR_193=value 193 of the spawn corpus
+set SPAWN_VAR_194=value 194 of the spawn corpus
+set SPAWN_VAR_195=value 195 of the spawn corpus
+set SPAWN_VAR_196=value 196 of the spawn corpus
+set SPAWN_VAR_197=value 197 of the spawn corpus
+set SPAWN_VAR_198=value 198 of the spawn corpus
+set SPAWN_VAR_199=value 199 of the spawn corpus
+set SPAWN_VAR_200=value 200 of the spawn corpus
+set SPAWN_VAR_201=value 201 of the spawn corpus
+set SPAWN_VAR_202=value 202 of the spawn corpus
+set SPAWN_VAR_203=value 203 of the spawn corpus
+set SPAWN_VAR_204=value 204 of the spawn corpus
+set SPAWN_VAR_205=value 205 of the spawn corpus
+set SPAWN_VAR_206=value 206 of the spawn corpus
+set SPAWN_VAR_207=value 207 of the spawn corpus
+set SPAWN_VAR_208=value 208 of the spawn corpus
+set SPAWN_VAR_209=value 209 of the spawn corpus
+set SPAWN_VAR_210=value 210 of the spawn corpus
+set SPAWN_VAR_211=value 211 of the spawn corpus
+set SPAWN_VAR_212=value 212 of the spawn corpus
+set SPAWN_VAR_213=value 213 of the spawn corpus
+set SPAWN_VAR_214=value 214 of the spawn corpus
+set SPAWN_VAR_215=value 215 of the spawn corpus
+set SPAWN_VAR_216=value 216 of the spawn corpus
+set SPAWN_VAR_217=value 217 of the spawn corpus
+set SPAWN_VAR_218=value 218 of the spawn corpus
+set SPAWN_VAR_219=value 219 of the spawn corpus
+set SPAWN_VAR_220=value 220 of the spawn corpus
+set SPAWN_VAR_221=value 221 of the spawn corpus
+set SPAWN_VAR_222=value 222 of the spawn corpus
+set SPAWN_VAR_223=value 223 of the spawn corpus
+set SPAWN_VAR_224=value 224 of the spawn corpus
+set SPAWN_VAR_225=value 225 of the spawn corpus
+set SPAWN_VAR_226=value 226 of the spawn corpus
+set SPAWN_VAR_227=value 227 of the spawn corpus
+set SPAWN_VAR_228=value 228 of the spawn corpus
+set SPAWN_VAR_229=value 229 of the spawn corpus
+set SPAWN_VAR_230=value 230 of the spawn corpus
+set SPAWN_VAR_231=value 231 of the spawn corpus
+set SPAWN_VAR_232=value 232 of the spawn corpus
+set SPAWN_VAR_233=value 233 of the spawn corpus
+set SPAWN_VAR_234=value 234 of the spawn corpus
+set SPAWN_VAR_235=value 235 of the spawn corpus
+set SPAWN_VAR_236=value 236 of the spawn corpus
+set SPAWN_VAR_237=value 237 of the spawn corpus
+set SPAWN_VAR_238=value 238 of the spawn corpus
+set SPAWN_VAR_239=value 239 of the spawn corpus
+set SPAWN_VAR_240=value 240 of the spawn corpus
+set SPAWN_VAR_241=value 241 of the spawn corpus
+set SPAWN_VAR_242=value 242 of the spawn corpus
+set SPAWN_VAR_243=value 243 of the spawn corpus
+set SPAWN_VAR_244=value 244 of the spawn corpus
+set SPAWN_VAR_245=value 245 of the spawn corpus
+set SPAWN_VAR_246=value 246 of the spawn corpus
+set SPAWN_VAR_247=value 247 of the spawn corpus
+set SPAWN_VAR_248=value 248 of the spawn corpus
+set SPAWN_VAR_249=value 249 of the spawn corpus
+set SPAWN_VAR_250=value 250 of the spawn corpus
+set SPAWN_VAR_251=value 251 of the spawn corpus
+set SPAWN_VAR_252=value 252 of the spawn corpus
+set SPAWN_VAR_253=value 253 of the spawn corpus
+set SPAWN_VAR_254=value 254 of the spawn corpus
+set SPAWN_VAR_255=value 255 of the spawn corpus
+set SPAWN_VAR_256=value 256 of the spawn corpus
+set SPAWN_VAR_257=value 257 of the spawn corpus
+set SPAWN_VAR_258=value 258 of the spawn corpus
+set SPAWN_VAR_259=value 259 of the spawn corpus
+set SPAWN_VAR_260=value 260 of the spawn corpus
+set SPAWN_VAR_261=value 261 of the spawn corpus
+set SPAWN_VAR_262=value 262 of the spawn corpus
+set SPAWN_VAR_263=value 263 of the spawn corpus
+set SPAWN_VAR_264=value 264 of the spawn corpus
+set SPAWN_VAR_265=value 265 of the spawn corpus
+set SPAWN_VAR_266=value 266 of the spawn corpus
+set SPAWN_VAR_267=value 267 of the spawn corpus
+set SPAWN_VAR_268=value 268 of the spawn corpus
+set SPAWN_VAR_269=value 269 of the spawn corpus
+set SPAWN_VAR_270=value 270 of the spawn corpus
+set SPAWN_VAR_271=value 271 of the spawn corpus
+set SPAWN_VAR_272=value 272 of the spawn corpus
+set SPAWN_VAR_273=value 273 of the spawn corpus
+set SPAWN_VAR_274=value 274 of the spawn corpus
+set SPAWN_VAR_275=value 275 of the spawn corpus
+set SPAWN_VAR_276=value 276 of the spawn corpus
+set SPAWN_VAR_277=value 277 of the spawn corpus
+set SPAWN_VAR_278=value 278 of the spawn corpus
+set SPAWN_VAR_279=value 279 of the spawn corpus
+set SPAWN_VAR_280=value 280 of the spawn corpus
+set SPAWN_VAR_281=value 281 of the spawn corpus
+set SPAWN_VAR_282=value 282 of the spawn corpus
+set SPAWN_VAR_283=value 283 of the spawn corpus
+set SPAWN_VAR_284=value 284 of the spawn corpus
+set SPAWN_VAR_285=value 285 of the spawn corpus
+set SPAWN_VAR_286=value 286 of the spawn corpus
+set SPAWN_VAR_287=value 287 of the spawn corpus
+set SPAWN_VAR_288=value 288 of the spawn corpus
+set SPAWN_VAR_289=value 289 of the spawn corpus
+set SPAWN_VAR_290=value 290 of the spawn corpus
+set SPAWN_VAR_291=value 291 of the spawn corpus
+set SPAWN_VAR_292=value 292 of the spawn corpus
+set SPAWN_VAR_293=value 293 of the spawn corpus
+set SPAWN_VAR_294=value 294 of the spawn corpus
+set SPAWN_VAR_295=value 295 of the spawn corpus
+set SPAWN_VAR_296=value 296 of the spawn corpus
+set SPAWN_VAR_297=value 297 of the spawn corpus
+set SPAWN_VAR_298=value 298 of the spawn corpus
+set SPAWN_VAR_299=value 299 of the spawn corpus
+set SPAWN_VAR_300=value 300 of the spawn corpus
+set SPAWN_VAR_301=value 301 of the spawn corpus
+set SPAWN_VAR_302=value 302 of the spawn corpus
+set SPAWN_VAR_303=value 303 of the spawn corpus
+set SPAWN_VAR_304=value 304 of the spawn corpus
+set SPAWN_VAR_305=value 305 of the spawn corpus
+set SPAWN_VAR_306=value 306 of the spawn corpus
+set SPAWN_VAR_307=value 307 of the spawn corpus
+set SPAWN_VAR_308=value 308 of the spawn corpus
+set SPAWN_VAR_309=value 309 of the spawn corpus
+set SPAWN_VAR_310=value 310 of the spawn corpus
+set SPAWN_VAR_311=value 311 of the spawn corpus
+set SPAWN_VAR_312=value 312 of the spawn corpus
+set SPAWN_VAR_313=value 313 of the spawn corpus
+set SPAWN_VAR_314=value 314 of the spawn corpus
+set SPAWN_VAR_315=value 315 of the spawn corpus
+set SPAWN_VAR_316=value 316 of the spawn corpus
+set SPAWN_VAR_317=value 317 of the spawn corpus
+set SPAWN_VAR_318=value 318 of the spawn corpus
+set SPAWN_VAR_319=value 319 of the spawn corpus
+set SPAWN_VAR_320=value 320 of the spawn corpus
+set SPAWN_VAR_321=value 321 of the spawn corpus
+set SPAWN_VAR_322=value 322 of the spawn corpus
+set SPAWN_VAR_323=value 323 of the spawn corpus
+set SPAWN_VAR_324=value 324 of the spawn corpus
+set SPAWN_VAR_325=value 325 of the spawn corpus
+set SPAWN_VAR_326=value 326 of the spawn corpus
+set SPAWN_VAR_327=value 327 of the spawn corpus
+set SPAWN_VAR_328=value 328 of the spawn corpus
+set SPAWN_VAR_329=value 329 of the spawn corpus
+set SPAWN_VAR_330=value 330 of the spawn corpus
+set SPAWN_VAR_331=value 331 of the spawn corpus
+set SPAWN_VAR_332=value 332 of the spawn corpus
+set SPAWN_VAR_333=value 333 of the spawn corpus
+set SPAWN_VAR_334=value 334 of the spawn corpus
+set SPAWN_VAR_335=value 335 of the spawn corpus
+set SPAWN_VAR_336=value 336 of the spawn corpus
+set SPAWN_VAR_337=value 337 of the spawn corpus
+set SPAWN_VAR_338=value 338 of the spawn corpus
+set SPAWN_VAR_339=value 339 of the spawn corpus
+set SPAWN_VAR_340=value 340 of the spawn corpus
+set SPAWN_VAR_341=value 341 of the spawn corpus
+set SPAWN_VAR_342=value 342 of the spawn corpus
+set SPAWN_VAR_343=value 343 of the spawn corpus
+set SPAWN_VAR_344=value 344 of the spawn corpus
+set SPAWN_VAR_345=value 345 of the spawn corpus
+set SPAWN_VAR_346=value 346 of the spawn corpus
+set SPAWN_VAR_347=value 347 of the spawn corpus
+set SPAWN_VAR_348=value 348 of the spawn corpus
+set SPAWN_VAR_349=value 349 of the spawn corpus
+set SPAWN_VAR_350=value 350 of the spawn corpus
+set SPAWN_VAR_351=value 351 of the spawn corpus
+set SPAWN_VAR_352=value 352 of the spawn corpus
+set SPAWN_VAR_353=value 353 of the spawn corpus
+set SPAWN_VAR_354=value 354 of the spawn corpus
+set SPAWN_VAR_355=value 355 of the spawn corpus
+set SPAWN_VAR_356=value 356 of the spawn corpus
+set SPAWN_VAR_357=value 357 of the spawn corpus
+set SPAWN_VAR_358=value 358 of the spawn corpus
+set SPAWN_VAR_359=value 359 of the spawn corpus
+set SPAWN_VAR_360=value 360 of the spawn corpus
+set SPAWN_VAR_361=value 361 of the spawn corpus
+set SPAWN_VAR_362=value 362 of the spawn corpus
+set SPAWN_VAR_363=value 363 of the spawn corpus
+set SPAWN_VAR_364=value 364 of the spawn corpus
+set SPAWN_VAR_365=value 365 of the spawn corpus
+set SPAWN_VAR_366=value 366 of the spawn corpus
+set SPAWN_VAR_367=value 367 of the spawn corpus
+set SPAWN_VAR_368=value 368 of the spawn corpus
+set SPAWN_VAR_369=value 369 of the spawn corpus
+set SPAWN_VAR_370=value 370 of the spawn corpus
+set SPAWN_VAR_371=value 371 of the spawn corpus
+set SPAWN_VAR_372=value 372 of the spawn corpus
+set SPAWN_VAR_373=value 373 of the spawn corpus
+set SPAWN_VAR_374=value 374 of the spawn corpus
+set SPAWN_VAR_375=value 375 of the spawn corpus
+set SPAWN_VAR_376=value 376 of the spawn corpus
+set SPAWN_VAR_377=value 377 of the spawn corpus
+set SPAWN_VAR_378=value 378 of the spawn corpus
+set SPAWN_VAR_379=value 379 of the spawn corpus
+set SPAWN_VAR_380=value 380 of the spawn corpus
+set SPAWN_VAR_381=value 381 of the spawn corpus
+set SPAWN_VAR_382=value 382 of the spawn corpus
+set SPAWN_VAR_383=value 383 of the spawn corpus
+set SPAWN_VAR_384=value 384 of the spawn corpus
+set SPAWN_VAR_385=value 385 of the spawn corpus
+set SPAWN_VAR_386=value 386 of the spawn corpus
+set SPAWN_VAR_387=value 387 of the spawn corpus
+set SPAWN_VAR_388=value 388 of the spawn corpus
+set SPAWN_VAR_389=value 389 of the spawn corpus
+set SPAWN_VAR_390=value 390 of the spawn corpus
+set SPAWN_VAR_391=value 391 of the spawn corpus
+set SPAWN_VAR_392=value 392 of the spawn corpus
+set SPAWN_VAR_393=value 393 of the spawn corpus
+set SPAWN_VAR_394=value 394 of the spawn corpus
+set SPAWN_VAR_395=value 395 of the spawn corpus
+set SPAWN_VAR_396=value 396 of the spawn corpus
+set SPAWN_VAR_397=value 397 of the spawn corpus
+set SPAWN_VAR_398=value 398 of the spawn corpus
+set SPAWN_VAR_399=value 399 of the spawn corpus
+set SPAWN_VAR_400=value 400 of the spawn corpus
+set SPAWN_VAR_401=value 401 of the spawn corpus
+set SPAWN_VAR_402=value 402 of the spawn corpus
+set SPAWN_VAR_403=value 403 of the spawn corpus
+set SPAWN_VAR_404=value 404 of the spawn corpus
+set SPAWN_VAR_405=value 405 of the spawn corpus
+set SPAWN_VAR_406=value 406 of the spawn corpus
+set SPAWN_VAR_407=value 407 of the spawn corpus
+set SPAWN_VAR_408=value 408 of the spawn corpus
+set SPAWN_VAR_409=value 409 of the spawn corpus
+set SPAWN_VAR_410=value 410 of the spawn corpus
+set SPAWN_VAR_411=value 411 of the spawn corpus
+set SPAWN_VAR_412=value 412 of the spawn corpus
+set SPAWN_VAR_413=value 413 of the spawn corpus
+set SPAWN_VAR_414=value 414 of the spawn corpus
+set SPAWN_VAR_415=value 415 of the spawn corpus
+set SPAWN_VAR_416=value 416 of the spawn corpus
+set SPAWN_VAR_417=value 417 of the spawn corpus
+set SPAWN_VAR_418=value 418 of the spawn corpus
+set SPAWN_VAR_419=value 419 of the spawn corpus
+set SPAWN_VAR_420=value 420 of the spawn corpus
+set SPAWN_VAR_421=value 421 of the spawn corpus
+set SPAWN_VAR_422=value 422 of the spawn corpus
+set SPAWN_VAR_423=value 423 of the spawn corpus
+set SPAWN_VAR_424=value 424 of the spawn corpus
+set SPAWN_VAR_425=value 425 of the spawn corpus
+set SPAWN_VAR_426=value 426 of the spawn corpus
+set SPAWN_VAR_427=value 427 of the spawn corpus
+set SPAWN_VAR_428=value 428 of the spawn corpus
+set SPAWN_VAR_429=value 429 of the spawn corpus
+set SPAWN_VAR_430=value 430 of the spawn corpus
+set SPAWN_VAR_431=value 431 of the spawn corpus
+set SPAWN_VAR_432=value 432 of the spawn corpus
+set SPAWN_VAR_433=value 433 of the spawn corpus
+set SPAWN_VAR_434=value 434 of the spawn corpus
+set SPAWN_VAR_435=value 435 of the spawn corpus
+set SPAWN_VAR_436=value 436 of the spawn corpus
+set SPAWN_VAR_437=value 437 of the spawn corpus
+set SPAWN_VAR_438=value 438 of the spawn corpus
+set SPAWN_VAR_439=value 439 of the spawn corpus
+set SPAWN_VAR_440=value 440 of the spawn corpus
+set SPAWN_VAR_441=value 441 of the spawn corpus
+set SPAWN_VAR_442=value 442 of the spawn corpus
+set SPAWN_VAR_443=value 443 of the spawn corpus
+set SPAWN_VAR_444=value 444 of the spawn corpus
+set SPAWN_VAR_445=value 445 of the spawn corpus
+set SPAWN_VAR_446=value 446 of the spawn corpus
+set SPAWN_VAR_447=value 447 of the spawn corpus
+set SPAWN_VAR_448=value 448 of the spawn corpus
+set SPAWN_VAR_449=value 449 of the spawn corpus
+set SPAWN_VAR_450=value 450 of the spawn corpus
+set SPAWN_VAR_451=value 451 of the spawn corpus
+set SPAWN_VAR_452=value 452 of the spawn corpus
+set SPAWN_VAR_453=value 453 of the spawn corpus
+set SPAWN_VAR_454=value 454 of the spawn corpus
+set SPAWN_VAR_455=value 455 of the spawn corpus
+set SPAWN_VAR_456=value 456 of the spawn corpus
+set SPAWN_VAR_457=value 457 of the spawn corpus
+set SPAWN_VAR_458=value 458 of the spawn corpus
+set SPAWN_VAR_459=value 459 of the spawn corpus
+set SPAWN_VAR_460=value 460 of the spawn corpus
+set SPAWN_VAR_461=value 461 of the spawn corpus
+set SPAWN_VAR_462=value 462 of the spawn corpus
+set SPAWN_VAR_463=value 463 of the spawn corpus
+set SPAWN_VAR_464=value 464 of the spawn corpus
+set SPAWN_VAR_465=value 465 of the spawn corpus
+set SPAWN_VAR_466=value 466 of the spawn corpus
+set SPAWN_VAR_467=value 467 of the spawn corpus
+set SPAWN_VAR_468=value 468 of the spawn corpus
+set SPAWN_VAR_469=value 469 of the spawn corpus
+set SPAWN_VAR_470=value 470 of the spawn corpus
+set SPAWN_VAR_471=value 471 of the spawn corpus
+set SPAWN_VAR_472=value 472 of the spawn corpus
+set SPAWN_VAR_473=value 473 of the spawn corpus
+set SPAWN_VAR_474=value 474 of the spawn corpus
+set SPAWN_VAR_475=value 475 of the spawn corpus
+set SPAWN_VAR_476=value 476 of the spawn corpus
+set SPAWN_VAR_477=value 477 of the spawn corpus
+set SPAWN_VAR_478=value 478 of the spawn corpus
+set SPAWN_VAR_479=value 479 of the spawn corpus
+set SPAWN_VAR_480=value 480 of the spawn corpus
+set SPAWN_VAR_481=value 481 of the spawn corpus
+set SPAWN_VAR_482=value 482 of the spawn corpus
+set SPAWN_VAR_483=value 483 of the spawn corpus
+set SPAWN_VAR_484=value 484 of the spawn corpus
+set SPAWN_VAR_485=value 485 of the spawn corpus
+set SPAWN_VAR_486=value 486 of the spawn corpus
+set SPAWN_VAR_487=value 487 of the spawn corpus
+set SPAWN_VAR_488=value 488 of the spawn corpus
+set SPAWN_VAR_489=value 489 of the spawn corpus
+set SPAWN_VAR_490=value 490 of the spawn corpus
+set SPAWN_VAR_491=value 491 of the spawn corpus
+set SPAWN_VAR_492=value 492 of the spawn corpus
+set SPAWN_VAR_493=value 493 of the spawn corpus
+set SPAWN_VAR_494=value 494 of the spawn corpus
+set SPAWN_VAR_495=value 495 of the spawn corpus
+set SPAWN_VAR_496=value 496 of the spawn corpus
+set SPAWN_VAR_497=value 497 of the spawn corpus
+set SPAWN_VAR_498=value 498 of the spawn corpus
+set SPAWN_VAR_499=value 499 of the spawn corpus
+set SPAWN_VAR_500=value 500 of the spawn corpus
+for %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 38 39 40 41 42 43 44 45 46 47 48 49 50) do standin exit=0
+for %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31 32 33 34 35 36 37 38 39 40 41 42 43 44 45 46 47 48 49 50) do (set SPAWN_TICK=%a& standin exit=0)
+endlocal
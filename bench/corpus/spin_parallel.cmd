@@ -0,0 +1,3 @@
+:: The loop of spin_sequential.cmd on four workers: CPU-bound programs, one per iteration, so
+:: the wall time against that script is the FOR /J:4 speedup.
+for /J:4 %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16) do standin spin=50 exit=0
@@ -0,0 +1,3 @@
+:: CPU-bound programs run one after another, each computing for a fixed number of steps; the
+:: baseline for spin_parallel.cmd.
+for %a in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16) do standin spin=50 exit=0
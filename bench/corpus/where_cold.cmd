@@ -0,0 +1,6 @@
+:: One WHERE over a 64-directory PATH before any index exists, so every directory is listed.
+:: Only the first run of a replay is cold: later repeats find the index the first one built.
+setlocal
+set PATH=C:\corpus\dir00;C:\corpus\dir00\sub0;C:\corpus\dir00\sub1;C:\corpus\dir00\sub2;C:\corpus\dir01;C:\corpus\dir01\sub0;C:\corpus\dir01\sub1;C:\corpus\dir01\sub2;C:\corpus\dir02;C:\corpus\dir02\sub0;C:\corpus\dir02\sub1;C:\corpus\dir02\sub2;C:\corpus\dir03;C:\corpus\dir03\sub0;C:\corpus\dir03\sub1;C:\corpus\dir03\sub2;C:\corpus\dir04;C:\corpus\dir04\sub0;C:\corpus\dir04\sub1;C:\corpus\dir04\sub2;C:\corpus\dir05;C:\corpus\dir05\sub0;C:\corpus\dir05\sub1;C:\corpus\dir05\sub2;C:\corpus\dir06;C:\corpus\dir06\sub0;C:\corpus\dir06\sub1;C:\corpus\dir06\sub2;C:\corpus\dir07;C:\corpus\dir07\sub0;C:\corpus\dir07\sub1;C:\corpus\dir07\sub2;C:\corpus\dir08;C:\corpus\dir08\sub0;C:\corpus\dir08\sub1;C:\corpus\dir08\sub2;C:\corpus\dir09;C:\corpus\dir09\sub0;C:\corpus\dir09\sub1;C:\corpus\dir09\sub2;C:\corpus\dir10;C:\corpus\dir10\sub0;C:\corpus\dir10\sub1;C:\corpus\dir10\sub2;C:\corpus\dir11;C:\corpus\dir11\sub0;C:\corpus\dir11\sub1;C:\corpus\dir11\sub2;C:\corpus\dir12;C:\corpus\dir12\sub0;C:\corpus\dir12\sub1;C:\corpus\dir12\sub2;C:\corpus\dir13;C:\corpus\dir13\sub0;C:\corpus\dir13\sub1;C:\corpus\dir13\sub2;C:\corpus\dir14;C:\corpus\dir14\sub0;C:\corpus\dir14\sub1;C:\corpus\dir14\sub2;C:\corpus\dir15;C:\corpus\dir15\sub0;C:\corpus\dir15\sub1;C:\corpus\dir15\sub2
+where file007
+endlocal
@@ -0,0 +1,8 @@
+:: WHERE /R: walks of the whole corpus tree and of single directories, which never use the
+:: index.
+where /R C:\corpus part24.dat
+where /R C:\corpus file1*.log
+where /R . *.dat
+where /R dir05 file000.log part00.dat
+where /Q /R C:\corpus nosuchfile || echo missing
+for %a in (dir00 dir01 dir02 dir03) do where /R %a file19?.txt
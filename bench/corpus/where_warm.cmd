@@ -0,0 +1,16 @@
+:: WHERE over the same PATH once the index is built: each query stats the 64 directories and
+:: lists none of them.
+setlocal
+set PATH=C:\corpus\dir00;C:\corpus\dir00\sub0;C:\corpus\dir00\sub1;C:\corpus\dir00\sub2;C:\corpus\dir01;C:\corpus\dir01\sub0;C:\corpus\dir01\sub1;C:\corpus\dir01\sub2;C:\corpus\dir02;C:\corpus\dir02\sub0;C:\corpus\dir02\sub1;C:\corpus\dir02\sub2;C:\corpus\dir03;C:\corpus\dir03\sub0;C:\corpus\dir03\sub1;C:\corpus\dir03\sub2;C:\corpus\dir04;C:\corpus\dir04\sub0;C:\corpus\dir04\sub1;C:\corpus\dir04\sub2;C:\corpus\dir05;C:\corpus\dir05\sub0;C:\corpus\dir05\sub1;C:\corpus\dir05\sub2;C:\corpus\dir06;C:\corpus\dir06\sub0;C:\corpus\dir06\sub1;C:\corpus\dir06\sub2;C:\corpus\dir07;C:\corpus\dir07\sub0;C:\corpus\dir07\sub1;C:\corpus\dir07\sub2;C:\corpus\dir08;C:\corpus\dir08\sub0;C:\corpus\dir08\sub1;C:\corpus\dir08\sub2;C:\corpus\dir09;C:\corpus\dir09\sub0;C:\corpus\dir09\sub1;C:\corpus\dir09\sub2;C:\corpus\dir10;C:\corpus\dir10\sub0;C:\corpus\dir10\sub1;C:\corpus\dir10\sub2;C:\corpus\dir11;C:\corpus\dir11\sub0;C:\corpus\dir11\sub1;C:\corpus\dir11\sub2;C:\corpus\dir12;C:\corpus\dir12\sub0;C:\corpus\dir12\sub1;C:\corpus\dir12\sub2;C:\corpus\dir13;C:\corpus\dir13\sub0;C:\corpus\dir13\sub1;C:\corpus\dir13\sub2;C:\corpus\dir14;C:\corpus\dir14\sub0;C:\corpus\dir14\sub1;C:\corpus\dir14\sub2;C:\corpus\dir15;C:\corpus\dir15\sub0;C:\corpus\dir15\sub1;C:\corpus\dir15\sub2
+where file007
+where file123.log
+where part07.dat
+where nosuchfile
+where /Q file042.txt && echo found
+where /Q nosuchfile || echo missing
+where file00*
+where *.log
+where part1?.dat file199.txt
+for %a in (file001 file050 file100 file150 file199) do where %a
+for %a in (1 2 3 4 5 6 7 8 9 10) do where /Q part0%a.dat
+endlocal
@@ -0,0 +1,90 @@
+#ifdef _WIN32
+#pragma comment(lib, "Advapi32.lib")
+#endif
+
+// Measures repeated DIR of the same directories on the native file system, with and without the
+// listing cache in front of it. For each directory it reports the first DIR, the mean of the
+// repeats after it, and the backend listings and cache hits those repeats caused.
+//
+// Usage: dir_repeat [-n repeats] directory...
+//
+// The first DIR through the cache also starts watching the directory, so it costs slightly more
+// than an uncached one. The report goes to standard error; the listings themselves are discarded.
+
+#include "../src/filesystem.hpp"
+#include "../src/run_command.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Swallows everything written to it.
+class NullBuffer : public std::streambuf {
+  protected:
+    int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+static double time_dir(const std::string &command) {
+    auto start = std::chrono::steady_clock::now();
+    run_command(command.c_str(), 0);
+    std::cout.flush();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+int main(int argc, char **argv) {
+    int repeats = 20;
+    std::vector<std::string> dirs;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            repeats = std::max(1, std::atoi(argv[++i]));
+            continue;
+        }
+        dirs.emplace_back(argv[i]);
+    }
+    if (dirs.empty()) {
+        std::cerr << "usage: dir_repeat [-n repeats] directory...\n";
+        return 2;
+    }
+
+    echo_enabled = false;
+    NullBuffer discard;
+    std::streambuf *saved_out = std::cout.rdbuf(&discard);
+    std::streambuf *saved_err = std::cerr.rdbuf(&discard);
+    std::ostream report(saved_err);
+
+    report << std::left << std::setw(40) << "directory" << std::setw(10) << "backend"
+           << std::right << std::setw(12) << "first ms" << std::setw(12) << "repeat ms"
+           << std::setw(12) << "listings" << std::setw(12) << "cache hits" << "\n";
+
+    for (const std::string &dir : dirs) {
+        std::string command = "dir \"" + dir + "\"";
+        for (bool cached : {false, true}) {
+            if (cached)
+                set_file_system(std::make_unique<CachedFileSystem>(make_native_file_system()));
+            else
+                set_file_system(make_native_file_system());
+            double first = time_dir(command);
+            FileSystemStats &s = file_system().stats();
+            s.reset();
+            double total = 0;
+            for (int r = 0; r < repeats; ++r)
+                total += time_dir(command);
+            report << std::left << std::setw(40) << dir << std::setw(10)
+                   << (cached ? "cached" : "native") << std::right << std::fixed
+                   << std::setprecision(3) << std::setw(12) << first << std::setw(12)
+                   << total / repeats << std::setw(12) << s.listings / repeats << std::setw(12)
+                   << s.cache_hits / repeats << "\n";
+        }
+    }
+
+    std::cout.rdbuf(saved_out);
+    std::cerr.rdbuf(saved_err);
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Measures how fast the lexer splits command lines of the longest length CMD accepts, 8191
+// characters, for a few shapes of line: one long argument, many short words, quoted words, words
+// full of carets, a chain of commands joined by operators, and the text after ECHO.
+//
+// Usage: lexer [-n lines]
+//
+// For each shape the report gives lines per second, MB of input per second and tokens per line.
+
+#include "../src/tokenizer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+static constexpr size_t max_line = 8191;
+
+// Repeats piece after prefix and cuts the line at CMD's limit.
+static std::string long_line(const std::string &prefix, const std::string &piece) {
+    std::string line = prefix;
+    while (line.size() < max_line)
+        line += piece;
+    line.resize(max_line);
+    return line;
+}
+
+// Keeps the token counts alive so the lexing is not optimized away.
+static volatile size_t token_count;
+
+static void report_case(const char *name, const std::string &line, int lines) {
+    size_t tokens = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lines; ++i) {
+        cmd::Tokenizer tok(line.c_str());
+        tokens += tok.tokenize().size();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    token_count = tokens;
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    double per_sec = seconds > 0 ? lines / seconds : 0;
+    std::cout << std::left << std::setw(18) << name << std::right << std::fixed
+              << std::setprecision(0) << std::setw(12) << per_sec << std::setprecision(1)
+              << std::setw(10) << per_sec * line.size() / (1 << 20) << std::setprecision(0)
+              << std::setw(10) << static_cast<double>(tokens) / lines << "\n";
+}
+
+int main(int argc, char **argv) {
+    int lines = 20000;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            lines = std::max(1, std::atoi(argv[++i]));
+    }
+
+    std::cout << std::left << std::setw(18) << "line" << std::right << std::setw(12) << "lines/s"
+              << std::setw(10) << "MB/s" << std::setw(10) << "tokens" << "\n";
+
+    report_case("one argument", long_line("echo ", "abcdefghijklmnopqrstuvwxyz0123456789"), lines);
+    report_case("short words", long_line("echo", " ab cd.txt /x"), lines);
+    report_case("quoted words", long_line("copy", " \"C:\\Program Files\\app\\file.txt\""),
+                lines);
+    report_case("carets", long_line("echo ", "a^&b^|c^>d "), lines);
+    report_case("operators", long_line("", "cd dir && dir /b || echo no & "), lines);
+    report_case("echo text", long_line("echo.", "The quick brown fox jumps over the dog. "),
+                lines);
+    return 0;
+}
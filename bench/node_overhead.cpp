@@ -0,0 +1,123 @@
+#ifdef _WIN32
+#pragma comment(lib, "Advapi32.lib")
+#endif
+
+// Measures what walking the execution tree costs per node, apart from the commands it runs. Each
+// case is a FOR over 1000 items whose body is executed from the parsed tree on every iteration;
+// the body's commands are SETs, and the same SETs called directly give the cost of the builtin
+// alone. What is left, divided by the nodes in the body, is the overhead of dispatching a node:
+// binding the loop variable into its words, building argv, finding the builtin and applying
+// redirections that open nothing.
+//
+// Usage: node_overhead [-n loops]
+//
+// The last row runs one SET per command line through run_command, so expanding, lexing and
+// parsing the line are included.
+
+#include "../src/filesystem.hpp"
+#include "../src/run_command.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+// Swallows everything written to it.
+class NullBuffer : public std::streambuf {
+  protected:
+    int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+static constexpr int items_per_loop = 1000;
+
+static double ns_per_iteration(int loops, const std::function<void()> &run_loop) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; ++i)
+        run_loop();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / loops / items_per_loop;
+}
+
+static void report_case(std::ostream &report, const char *name, int nodes, int commands,
+                        double ns, double set_ns) {
+    report << std::left << std::setw(24) << name << std::right << std::setw(7) << nodes
+           << std::fixed << std::setprecision(0) << std::setw(12) << ns << std::setw(12)
+           << (ns - commands * set_ns) / std::max(nodes, 1) << "\n";
+}
+
+// Runs items_per_loop SETs, one command line each.
+static void set_per_line() {
+    char line[32];
+    for (int i = 0; i < items_per_loop; ++i) {
+        std::snprintf(line, sizeof(line), "set A=%d", i);
+        run_command(line, 0);
+    }
+}
+
+int main(int argc, char **argv) {
+    int loops = 200;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            loops = std::max(1, std::atoi(argv[++i]));
+    }
+
+    set_file_system(make_native_file_system());
+    echo_enabled = false;
+    NullBuffer discard;
+    std::streambuf *saved_out = std::cout.rdbuf(&discard);
+    std::ostream report(saved_out);
+
+    std::string set = "(";
+    for (int i = 0; i < items_per_loop; ++i) {
+        if (i > 0)
+            set += ' ';
+        set += std::to_string(i);
+    }
+    set += ")";
+    auto for_loop = [&](const char *body) {
+        std::string line = "for %a in " + set + " do " + body;
+        return [line] { run_command(line.c_str(), 0); };
+    };
+
+    // The builtin on its own, with the argv the tree would have built.
+    double set_ns = ns_per_iteration(loops, [] {
+        char name[] = "set";
+        char value[16];
+        for (int i = 0; i < items_per_loop; ++i) {
+            std::snprintf(value, sizeof(value), "A=%d", i);
+            char *args[] = {name, value, nullptr};
+            cmd_set(2, args);
+        }
+    });
+
+    struct Case {
+        const char *name;
+        int nodes;
+        int commands;
+        std::function<void()> run_loop;
+    };
+    Case cases[] = {
+        {"()", 1, 0, for_loop("()")},
+        {"set A=%a", 1, 1, for_loop("set A=%a")},
+        {"4 SETs joined by &", 8, 4, for_loop("(set A=%a & set B=%a & set C=%a & set D=%a)")},
+        {"4 SETs joined by &&", 8, 4, for_loop("(set A=%a && set B=%a && set C=%a && set D=%a)")},
+        {"set A=%a 2>&1", 2, 1, for_loop("set A=%a 2>&1")},
+        {"one SET per line", 1, 1, set_per_line},
+    };
+
+    report << std::left << std::setw(24) << "body" << std::right << std::setw(7) << "nodes"
+           << std::setw(12) << "ns/iter" << std::setw(12) << "ns/node" << "\n";
+    report_case(report, "SET called directly", 0, 1, set_ns, set_ns);
+    for (const Case &c : cases)
+        report_case(report, c.name, c.nodes, c.commands, ns_per_iteration(loops, c.run_loop),
+                    set_ns);
+
+    std::cout.rdbuf(saved_out);
+    return 0;
+}
@@ -0,0 +1,83 @@
+#ifdef _WIN32
+#pragma comment(lib, "Advapi32.lib")
+#endif
+
+// Measures what drawing the prompt costs the interactive loop on each line, on the native file
+// system. The baseline is what the loop did before prompts were compiled: ask the file system for
+// the current directory and build "$P$G" again on every line. The other rows render compiled
+// templates through render_prompt(), once with the directory unchanged between lines and once
+// with it changed by CD before every line.
+//
+// Usage: prompt_cost [-n renders]
+//
+// For each case the report gives the mean time per line and the file system calls per line.
+
+#include "../src/filesystem.hpp"
+#include "../src/prompt.hpp"
+#include "../src/run_command.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Keeps the rendered lengths alive so the rendering is not optimized away.
+static volatile size_t rendered_bytes;
+
+static void report_case(const char *name, int renders, const std::function<size_t()> &draw_line) {
+    FileSystemStats &s = file_system().stats();
+    s.reset();
+    size_t total = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < renders; ++i)
+        total += draw_line();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    rendered_bytes = total;
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count() / renders;
+    uint64_t calls = s.cwd_queries + s.cwd_changes + s.stats + s.listings + s.volume_queries;
+    std::cout << std::left << std::setw(28) << name << std::right << std::fixed
+              << std::setprecision(1) << std::setw(14) << ns << std::setprecision(2)
+              << std::setw(14) << static_cast<double>(calls) / renders << "\n";
+}
+
+int main(int argc, char **argv) {
+    int renders = 200000;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            renders = std::max(1, std::atoi(argv[++i]));
+    }
+
+    set_file_system(make_native_file_system());
+
+    std::cout << std::left << std::setw(28) << "prompt" << std::right << std::setw(14)
+              << "ns/line" << std::setw(14) << "fs calls" << "\n";
+
+    report_case("$P$G rebuilt every line", renders, [&] {
+        std::string dir;
+        file_system().get_current_dir(dir);
+        std::string prompt = dir + ">";
+        return prompt.size();
+    });
+
+    set_prompt("$P$G");
+    report_case("$P$G", renders, [] { return render_prompt().size(); });
+
+    // What CD does to the prompt, without the cost of CD itself.
+    report_case("$P$G after CD", renders, [] {
+        invalidate_current_directory();
+        return render_prompt().size();
+    });
+
+    set_prompt("$N$G");
+    report_case("$N$G", renders, [] { return render_prompt().size(); });
+
+    set_prompt("$T$G");
+    report_case("$T$G", renders, [] { return render_prompt().size(); });
+
+    set_prompt("$P$_$D $T$G");
+    report_case("$P$_$D $T$G", renders, [] { return render_prompt().size(); });
+    return 0;
+}
@@ -0,0 +1,288 @@
+#ifdef _WIN32
+#pragma comment(lib, "Advapi32.lib")
+#endif
+
+// Replays batch scripts through run_command and reports what each one cost: wall time, source
+// lines per second, the I/O system calls the process made, the file system backend operations
+// and, in an ALLOC_STATS=1 build, heap allocations.
+//
+// Usage: replay [-n repeats] script-or-directory...
+//
+// A directory stands for every .cmd file in it, in name order. Scripts are written as they would
+// be typed at the prompt: blank lines and lines starting with "::" are skipped, and a line that
+// leaves a block open continues on the next one. Every run starts in C:\corpus on an in-memory
+// tree built here, so CD and DIR see the same entries on every machine. External programs are
+// real processes; the corpus calls standin, which is found because the directory of this program
+// is put first on PATH.
+//
+// The harness builds on Linux as well, where programs are started with posix_spawn and the I/O
+// calls are the read and write system calls counted in /proc/self/io rather than all the I/O
+// operations Windows counts, so the two columns are not comparable across systems.
+//
+// The report goes to standard error. Output of the builtins is discarded, but a program started
+// without a redirection writes to the real standard output, so run with that sent to NUL or
+// /dev/null.
+
+#include "../src/alloc_stats.hpp"
+#include "../src/environment.hpp"
+#include "../src/filesystem.hpp"
+#include "../src/run_command.hpp"
+#include "../src/tokenizer.hpp"
+#include "../src/utf.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+static const char *const corpus_root = "C:\\corpus";
+
+// Swallows everything written to it.
+class NullBuffer : public std::streambuf {
+  protected:
+    int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+struct Script {
+    std::string name;
+    size_t lines = 0;
+    std::vector<std::string> statements;
+};
+
+struct Counters {
+    uint64_t io_calls = 0;
+    uint64_t fs_calls = 0;
+    uint64_t allocations = 0;
+    uint64_t alloc_bytes = 0;
+};
+
+// 16 directories of 200 files each, with 4 subdirectories holding 25 more. Sizes and times
+// are derived from the indices.
+static std::unique_ptr<FileSystem> make_corpus_tree() {
+    auto fs = std::make_unique<MemoryFileSystem>();
+    fs->add_drive('C', "CORPUS", 0x0C0A0000);
+    const std::time_t base = 1700000000;
+    fs->make_dir(corpus_root, base);
+    char name[64];
+    for (int d = 0; d < 16; ++d) {
+        std::snprintf(name, sizeof(name), "%s\\dir%02d", corpus_root, d);
+        std::string dir = name;
+        fs->make_dir(dir, base + d);
+        for (int f = 0; f < 200; ++f) {
+            std::snprintf(name, sizeof(name), "\\file%03d.%s", f, f % 5 == 0 ? "log" : "txt");
+            uint64_t size = (f * 7919u + d * 104729u) % 65536;
+            fs->add_file(dir + name, size, base + f * 60, f % 50 == 0);
+        }
+        for (int s = 0; s < 4; ++s) {
+            std::snprintf(name, sizeof(name), "\\sub%d", s);
+            std::string sub = dir + name;
+            fs->make_dir(sub, base + s);
+            for (int f = 0; f < 25; ++f) {
+                std::snprintf(name, sizeof(name), "\\part%02d.dat", f);
+                fs->add_file(sub + name, f * 512, base + f);
+            }
+        }
+    }
+    return fs;
+}
+
+static bool block_is_open(const std::string &text) {
+    cmd::Tokenizer tok(text.c_str());
+    tok.tokenize();
+    return tok.open_blocks() > 0;
+}
+
+static bool load_script(const std::filesystem::path &path, Script &out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+    out.name = path.filename().string();
+    std::string line, statement;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line.compare(first, 2, "::") == 0)
+            continue;
+        ++out.lines;
+        if (!statement.empty())
+            statement += '\n';
+        statement += line;
+        if (!block_is_open(statement)) {
+            out.statements.push_back(std::move(statement));
+            statement.clear();
+        }
+    }
+    if (!statement.empty())
+        out.statements.push_back(std::move(statement));
+    return true;
+}
+
+static uint64_t io_calls() {
+#ifdef _WIN32
+    IO_COUNTERS io{};
+    if (!GetProcessIoCounters(GetCurrentProcess(), &io))
+        return 0;
+    return io.ReadOperationCount + io.WriteOperationCount + io.OtherOperationCount;
+#else
+    std::ifstream in("/proc/self/io");
+    std::string key;
+    uint64_t value = 0, total = 0;
+    while (in >> key >> value)
+        if (key == "syscr:" || key == "syscw:")
+            total += value;
+    return total;
+#endif
+}
+
+static Counters read_counters() {
+    Counters c;
+    c.io_calls = io_calls();
+    FileSystemStats &s = file_system().stats();
+    c.fs_calls = s.cwd_queries + s.cwd_changes + s.stats + s.listings + s.volume_queries;
+    if (alloc_stats_enabled) {
+        std::vector<AllocStats> heap = alloc_stats();
+        c.allocations = heap.back().allocations;
+        c.alloc_bytes = heap.back().bytes;
+    }
+    return c;
+}
+
+// The directory this program was started from, where standin is built too.
+static std::string program_dir() {
+#ifdef _WIN32
+    wchar_t buf[MAX_PATH];
+    DWORD len = GetModuleFileNameW(nullptr, buf, MAX_PATH);
+    std::string path = narrow(std::wstring_view(buf, len < MAX_PATH ? len : 0));
+    size_t slash = path.find_last_of('\\');
+#else
+    char buf[4096];
+    ssize_t len = readlink("/proc/self/exe", buf, sizeof(buf));
+    std::string path(buf, len > 0 ? static_cast<size_t>(len) : 0);
+    size_t slash = path.find_last_of('/');
+#endif
+    return slash == std::string::npos ? std::string(".") : path.substr(0, slash);
+}
+
+static void reset_shell_state() {
+    file_system().set_current_dir(corpus_root);
+    set_drive_dir('C', corpus_root);
+    invalidate_current_directory();
+}
+
+int main(int argc, char **argv) {
+    int repeats = 1;
+    std::vector<std::filesystem::path> inputs;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            repeats = std::max(1, std::atoi(argv[++i]));
+            continue;
+        }
+        inputs.emplace_back(argv[i]);
+    }
+    if (inputs.empty()) {
+        std::cerr << "usage: replay [-n repeats] script-or-directory...\n";
+        return 2;
+    }
+
+    std::vector<Script> scripts;
+    for (const auto &input : inputs) {
+        std::vector<std::filesystem::path> files;
+        std::error_code ec;
+        if (std::filesystem::is_directory(input, ec)) {
+            for (const auto &entry : std::filesystem::directory_iterator(input, ec))
+                if (entry.path().extension() == ".cmd")
+                    files.push_back(entry.path());
+            std::sort(files.begin(), files.end());
+        } else {
+            files.push_back(input);
+        }
+        for (const auto &file : files) {
+            Script script;
+            if (!load_script(file, script)) {
+                std::cerr << "replay: cannot read " << file.string() << "\n";
+                return 1;
+            }
+            scripts.push_back(std::move(script));
+        }
+    }
+
+    set_file_system(make_corpus_tree());
+    echo_enabled = false;
+
+    // WHERE keeps its index in this file. Starting without one makes the first WHERE script
+    // measure cold queries.
+    std::error_code ec;
+    std::filesystem::path index =
+        std::filesystem::temp_directory_path(ec) / "opencmd-replay-where.idx";
+    std::filesystem::remove(index, ec);
+    set_env_var("OPENCMD_WHERE_INDEX", index.string());
+
+    // Scripts that write to disk do so under TEMP, which POSIX systems do not set.
+    std::string temp;
+    if (!get_env_var("TEMP", temp) || temp.empty())
+        set_env_var("TEMP", std::filesystem::temp_directory_path(ec).string());
+
+    // The shell looks programs up along its own PATH.
+    std::string path;
+    get_env_var("PATH", path);
+    set_env_var("PATH", program_dir() + (path.empty() ? "" : ";" + path));
+
+    NullBuffer discard;
+    std::streambuf *saved_out = std::cout.rdbuf(&discard);
+    std::streambuf *saved_err = std::cerr.rdbuf(&discard);
+    std::ostream report(saved_err);
+
+    report << std::left << std::setw(20) << "script" << std::right << std::setw(8) << "lines"
+           << std::setw(12) << "wall ms" << std::setw(12) << "lines/s" << std::setw(12)
+           << "io calls" << std::setw(12) << "fs calls" << std::setw(12) << "allocs"
+           << std::setw(12) << "alloc KB" << "\n";
+
+    for (const Script &script : scripts) {
+        reset_shell_state();
+        Counters before = read_counters();
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) {
+            if (r > 0)
+                reset_shell_state();
+            for (const std::string &statement : script.statements)
+                run_command(statement.c_str(), 0);
+        }
+        std::cout.flush();
+        std::cerr.flush();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        Counters after = read_counters();
+
+        double ms = std::chrono::duration<double, std::milli>(elapsed).count() / repeats;
+        double per_sec = ms > 0 ? script.lines * 1000.0 / ms : 0;
+        report << std::left << std::setw(20) << script.name << std::right << std::setw(8)
+               << script.lines << std::fixed << std::setprecision(2) << std::setw(12) << ms
+               << std::setprecision(0) << std::setw(12) << per_sec << std::setw(12)
+               << (after.io_calls - before.io_calls) / repeats << std::setw(12)
+               << (after.fs_calls - before.fs_calls) / repeats;
+        if (alloc_stats_enabled)
+            report << std::setw(12) << (after.allocations - before.allocations) / repeats
+                   << std::setw(12) << (after.alloc_bytes - before.alloc_bytes) / repeats / 1024;
+        else
+            report << std::setw(12) << "-" << std::setw(12) << "-";
+        report << "\n";
+    }
+
+    std::cout.rdbuf(saved_out);
+    std::cerr.rdbuf(saved_err);
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Measures SORT's throughput on generated text, with its runs sorted by one thread and by one
+// thread per processor. Each input is sorted three ways: mapped from a disk file, read from a pipe
+// as SORT reads the left side of "a | sort", and read from the disk file with a memory limit
+// small enough that the runs are spilled to temporary files and merged.
+//
+// Usage: sort_throughput [-n lines]
+//
+// The report gives MB of input and lines sorted per second. The sorted output is discarded.
+
+#include "../src/external_sort.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+// Swallows everything written to it.
+class NullBuffer : public std::streambuf {
+  protected:
+    int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
+
+// Lines of mixed-case words of varying length, from a fixed seed so every run sorts the same text.
+static std::string make_text(size_t lines) {
+    static const char *const words[] = {"alpha", "Bravo", "charlie", "DELTA", "echo",
+                                        "Foxtrot", "golf", "hotel", "India", "juliet"};
+    uint32_t state = 12345;
+    std::string text;
+    text.reserve(lines * 40);
+    for (size_t i = 0; i < lines; ++i) {
+        state = state * 1664525u + 1013904223u;
+        unsigned count = 2 + (state >> 28) % 6;
+        for (unsigned w = 0; w < count; ++w) {
+            state = state * 1664525u + 1013904223u;
+            if (w > 0)
+                text += ' ';
+            text += words[(state >> 24) % 10];
+            text += std::to_string(state % 1000);
+        }
+        text += "\r\n";
+    }
+    return text;
+}
+
+static NativeHandle write_temp_file(const std::string &text) {
+    NativeHandle h = create_temp_file("");
+    if (h == no_handle || !write_handle(h, text.data(), text.size()))
+        return no_handle;
+    return h;
+}
+
+// Sorts the text once and returns the seconds it took, or a negative value on failure.
+static double sort_seconds(const std::string &text, NativeHandle file, bool from_pipe,
+                           const SortOptions &options) {
+    NullBuffer discard;
+    std::ostream out(&discard);
+    std::string error;
+    auto start = std::chrono::steady_clock::now();
+    bool ok;
+    if (from_pipe) {
+        NativeHandle read_end, write_end;
+        if (!create_pipe(read_end, write_end))
+            return -1;
+        std::thread feeder([&] {
+            write_handle(write_end, text.data(), text.size());
+            close_handle(write_end);
+        });
+        ok = sort_lines(read_end, out, options, error);
+        close_handle(read_end);
+        feeder.join();
+    } else {
+        ok = rewind_handle(file) && sort_lines(file, out, options, error);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    if (!ok) {
+        std::cerr << "sort_throughput: " << error << "\n";
+        return -1;
+    }
+    return std::chrono::duration<double>(elapsed).count();
+}
+
+int main(int argc, char **argv) {
+    size_t lines = 1000000;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            lines = std::max(1, std::atoi(argv[++i]));
+    }
+
+    std::string text = make_text(lines);
+    NativeHandle file = write_temp_file(text);
+    if (file == no_handle) {
+        std::cerr << "sort_throughput: cannot write a temporary file\n";
+        return 1;
+    }
+    unsigned processors = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << lines << " lines, " << text.size() / (1 << 20) << " MB, " << processors
+              << " processors\n";
+    std::cout << std::left << std::setw(10) << "input" << std::right << std::setw(9) << "threads"
+              << std::setw(10) << "MB/s" << std::setw(14) << "lines/s" << "\n";
+
+    struct Case {
+        const char *name;
+        bool from_pipe;
+        size_t memory_limit;
+    };
+    const Case cases[] = {
+        {"mapped", false, SortOptions().memory_limit},
+        {"pipe", true, SortOptions().memory_limit},
+        {"spilled", false, std::max<size_t>(text.size() / 8, 1 << 16)},
+    };
+    for (const Case &c : cases) {
+        for (unsigned jobs : {1u, processors}) {
+            SortOptions options;
+            options.jobs = jobs;
+            options.memory_limit = c.memory_limit;
+            double seconds = sort_seconds(text, file, c.from_pipe, options);
+            if (seconds < 0)
+                return 1;
+            std::cout << std::left << std::setw(10) << c.name << std::right << std::setw(9)
+                      << jobs << std::fixed << std::setprecision(0) << std::setw(10)
+                      << text.size() / seconds / (1 << 20) << std::setw(14) << lines / seconds
+                      << "\n";
+            if (processors == 1)
+                break;
+        }
+    }
+    close_handle(file);
+    return 0;
+}
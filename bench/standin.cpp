@@ -0,0 +1,87 @@
+// A stand-in for the external programs the corpus scripts call, so that a replay measures the
+// shell rather than the tools it starts. Its output depends only on its arguments, and it does
+// no I/O beyond its standard handles.
+//
+// Arguments, in any order:
+//   lines=N   write N lines of pseudo-random text, the same N lines on every run
+//   width=N   make each of those lines N characters long (default 48)
+//   stdin     read standard input to the end and print how many lines it had
+//   exit=N    exit with status N (default 0)
+//   spin=N    compute for a while first: N million steps of a random number generator
+// Any other argument is echoed back on one line.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+static bool take_number(const char *arg, const char *key, long &out) {
+    size_t n = std::strlen(key);
+    if (std::strncmp(arg, key, n) != 0)
+        return false;
+    out = std::strtol(arg + n, nullptr, 10);
+    return true;
+}
+
+static void write_lines(long count, long width) {
+    std::string line;
+    uint32_t state = 0x9E3779B9u;
+    for (long i = 0; i < count; ++i) {
+        line.clear();
+        for (long k = 0; k < width; ++k) {
+            state = state * 1664525u + 1013904223u;
+            line += static_cast<char>('a' + (state >> 24) % 26);
+        }
+        line += '\n';
+        std::fwrite(line.data(), 1, line.size(), stdout);
+    }
+}
+
+// Kept out of registers so the loop is not optimized away.
+static volatile uint32_t spin_result;
+
+static void spin(long millions) {
+    uint32_t state = 0x9E3779B9u;
+    for (long m = 0; m < millions; ++m)
+        for (int i = 0; i < 1000000; ++i)
+            state = state * 1664525u + 1013904223u;
+    spin_result = state;
+}
+
+static long count_input_lines() {
+    char buf[65536];
+    long lines = 0;
+    size_t got;
+    while ((got = std::fread(buf, 1, sizeof(buf), stdin)) > 0)
+        for (size_t i = 0; i < got; ++i)
+            lines += buf[i] == '\n';
+    return lines;
+}
+
+int main(int argc, char **argv) {
+    long lines = 0, width = 48, status = 0, millions = 0;
+    bool read_input = false;
+    std::string echo;
+    for (int i = 1; i < argc; ++i) {
+        if (take_number(argv[i], "lines=", lines) || take_number(argv[i], "width=", width) ||
+            take_number(argv[i], "exit=", status) || take_number(argv[i], "spin=", millions))
+            continue;
+        if (std::strcmp(argv[i], "stdin") == 0) {
+            read_input = true;
+            continue;
+        }
+        if (!echo.empty())
+            echo += ' ';
+        echo += argv[i];
+    }
+
+    spin(millions);
+    if (read_input)
+        std::printf("%ld\n", count_input_lines());
+    if (!echo.empty())
+        std::printf("%s\n", echo.c_str());
+    write_lines(lines, width);
+    std::fflush(stdout);
+    return static_cast<int>(status);
+}
@@ -0,0 +1,135 @@
+// Measures UTF-8 <-> UTF-16 transcoding throughput in both directions for ASCII paths, mostly
+// ASCII text with accented letters, and CJK text. Each row compares the transcoder the shell uses
+// with its scalar loops alone (the same code built with OPENCMD_UTF_SCALAR) and, on Windows, with
+// MultiByteToWideChar and WideCharToMultiByte, which the shell called before it kept UTF-8.
+//
+// Usage: utf_throughput [-n passes]
+//
+// Each pass converts about 4 MB of input; the report gives MB of input per second.
+
+#include "../src/utf.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+
+// The same transcoder without its SIMD paths. Everything utf.cpp includes is already included
+// above, so only its definitions end up in the namespace.
+namespace scalar {
+#define OPENCMD_UTF_SCALAR
+#include "../src/utf.cpp"
+#undef OPENCMD_UTF_SCALAR
+} // namespace scalar
+
+static constexpr size_t input_bytes = size_t(4) << 20;
+
+static std::string repeat_to_size(const std::string &piece) {
+    std::string out;
+    out.reserve(input_bytes + piece.size());
+    while (out.size() < input_bytes)
+        out += piece;
+    return out;
+}
+
+// Keeps the converted lengths alive so the conversions are not optimized away.
+static volatile size_t converted_units;
+
+static double mb_per_sec(size_t bytes, int passes, const std::function<size_t()> &convert) {
+    size_t total = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; ++p)
+        total += convert();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    converted_units = total;
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0 ? bytes * double(passes) / seconds / (1 << 20) : 0;
+}
+
+int main(int argc, char **argv) {
+    int passes = 20;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            passes = std::max(1, std::atoi(argv[++i]));
+    }
+
+    struct Input {
+        const char *name;
+        std::string utf8;
+    };
+    Input inputs[] = {
+        {"ascii paths", repeat_to_size("C:\\Windows\\System32\\DriverStore\\FileRepository\\")},
+        {"accented text", repeat_to_size("Les fen\xC3\xAAtres du ch\xC3\xA2teau d'\xC3\xA9t\xC3\xA9"
+                                         " donnent sur la for\xC3\xAAt. ")},
+        {"cjk text", repeat_to_size("\xE6\x96\x87\xE5\xAD\x97\xE5\x8C\x96\xE3\x81\x91\xE3\x81\xAE"
+                                    "\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88")},
+    };
+
+    std::cout << std::left << std::setw(16) << "input" << std::setw(10) << "direction"
+              << std::right << std::setw(12) << "simd MB/s" << std::setw(14) << "scalar MB/s";
+#ifdef _WIN32
+    std::cout << std::setw(12) << "win32 MB/s";
+#endif
+    std::cout << "\n";
+
+    for (const Input &input : inputs) {
+        const std::string &utf8 = input.utf8;
+        std::u16string utf16 = utf8_to_utf16(utf8);
+        std::u16string wide_out(utf8.size(), u'\0');
+        std::string narrow_out(utf16.size() * 3, '\0');
+
+        double simd_in = mb_per_sec(utf8.size(), passes, [&] {
+            return utf8_to_utf16(utf8.data(), utf8.size(), wide_out.data());
+        });
+        double scalar_in = mb_per_sec(utf8.size(), passes, [&] {
+            return scalar::utf8_to_utf16(utf8.data(), utf8.size(), wide_out.data());
+        });
+        double simd_out = mb_per_sec(utf16.size() * 2, passes, [&] {
+            return utf16_to_utf8(utf16.data(), utf16.size(), narrow_out.data());
+        });
+        double scalar_out = mb_per_sec(utf16.size() * 2, passes, [&] {
+            return scalar::utf16_to_utf8(utf16.data(), utf16.size(), narrow_out.data());
+        });
+#ifdef _WIN32
+        double win32_in = mb_per_sec(utf8.size(), passes, [&] {
+            return static_cast<size_t>(MultiByteToWideChar(
+                CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()),
+                reinterpret_cast<wchar_t *>(wide_out.data()), static_cast<int>(wide_out.size())));
+        });
+        double win32_out = mb_per_sec(utf16.size() * 2, passes, [&] {
+            return static_cast<size_t>(WideCharToMultiByte(
+                CP_UTF8, 0, reinterpret_cast<const wchar_t *>(utf16.data()),
+                static_cast<int>(utf16.size()), narrow_out.data(),
+                static_cast<int>(narrow_out.size()), nullptr, nullptr));
+        });
+#endif
+
+        std::cout << std::fixed << std::setprecision(0);
+        std::cout << std::left << std::setw(16) << input.name << std::setw(10) << "8 -> 16"
+                  << std::right << std::setw(12) << simd_in << std::setw(14) << scalar_in;
+#ifdef _WIN32
+        std::cout << std::setw(12) << win32_in;
+#endif
+        std::cout << "\n";
+        std::cout << std::left << std::setw(16) << input.name << std::setw(10) << "16 -> 8"
+                  << std::right << std::setw(12) << simd_out << std::setw(14) << scalar_out;
+#ifdef _WIN32
+        std::cout << std::setw(12) << win32_out;
+#endif
+        std::cout << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,243 @@
+#include "alloc_stats.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+uint64_t peak_rss_bytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return 0;
+    return pmc.PeakWorkingSetSize;
+#else
+    struct rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+#ifndef OPENCMD_ALLOC_STATS
+
+std::vector<AllocStats> alloc_stats() { return {}; }
+
+void reset_alloc_stats() {}
+
+#else
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+struct ScopeCounters {
+    const char *name = nullptr;
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frees{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<int64_t> live{0};
+    std::atomic<int64_t> peak{0};
+};
+
+// A fixed table, so that registering a scope never allocates. Slot 0 collects allocations made
+// outside any scope; scopes past the end of the table are charged there too.
+static constexpr int max_scopes = 64;
+static ScopeCounters scopes[max_scopes];
+static std::atomic<int> scope_count{1};
+static ScopeCounters total;
+static std::mutex scope_mutex;
+static thread_local int current_scope = 0;
+
+static int find_scope(const char *name) {
+    std::lock_guard<std::mutex> lock(scope_mutex);
+    int n = scope_count.load();
+    for (int i = 1; i < n; ++i)
+        if (scopes[i].name == name || std::strcmp(scopes[i].name, name) == 0)
+            return i;
+    if (n == max_scopes)
+        return 0;
+    scopes[n].name = name;
+    scope_count = n + 1;
+    return n;
+}
+
+AllocScope::AllocScope(const char *name) : previous(current_scope) {
+    current_scope = find_scope(name);
+}
+
+AllocScope::~AllocScope() { current_scope = previous; }
+
+void AllocScope::enter(const char *name) { current_scope = find_scope(name); }
+
+static void charge_alloc(ScopeCounters &c, size_t n) {
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    c.bytes.fetch_add(n, std::memory_order_relaxed);
+    int64_t live = c.live.fetch_add(static_cast<int64_t>(n), std::memory_order_relaxed) +
+                   static_cast<int64_t>(n);
+    int64_t peak = c.peak.load(std::memory_order_relaxed);
+    while (live > peak && !c.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+static void charge_free(ScopeCounters &c, size_t n) {
+    c.frees.fetch_add(1, std::memory_order_relaxed);
+    c.live.fetch_sub(static_cast<int64_t>(n), std::memory_order_relaxed);
+}
+
+// Sits immediately in front of every block and records what the free has to undo.
+struct BlockHeader {
+    size_t size;
+    int scope;
+};
+
+static constexpr size_t header_space = alignof(std::max_align_t) > sizeof(BlockHeader)
+                                           ? alignof(std::max_align_t)
+                                           : sizeof(BlockHeader);
+
+static void *tracked_alloc(size_t n, size_t align) {
+    size_t offset = std::max(header_space, align);
+    void *raw;
+    if (align <= alignof(std::max_align_t)) {
+        raw = std::malloc(n + offset);
+    } else {
+#ifdef _WIN32
+        raw = _aligned_malloc(n + offset, align);
+#else
+        raw = std::aligned_alloc(align, (n + offset + align - 1) / align * align);
+#endif
+    }
+    if (!raw)
+        return nullptr;
+    char *p = static_cast<char *>(raw) + offset;
+    int scope = current_scope;
+    new (p - sizeof(BlockHeader)) BlockHeader{n, scope};
+    charge_alloc(scopes[scope], n);
+    charge_alloc(total, n);
+    return p;
+}
+
+static void tracked_free(void *ptr, size_t align) {
+    if (!ptr)
+        return;
+    char *p = static_cast<char *>(ptr);
+    const BlockHeader *h = reinterpret_cast<const BlockHeader *>(p - sizeof(BlockHeader));
+    charge_free(scopes[h->scope], h->size);
+    charge_free(total, h->size);
+    void *raw = p - std::max(header_space, align);
+    if (align <= alignof(std::max_align_t)) {
+        std::free(raw);
+        return;
+    }
+#ifdef _WIN32
+    _aligned_free(raw);
+#else
+    std::free(raw);
+#endif
+}
+
+static void *throwing_alloc(size_t n, size_t align) {
+    void *p = tracked_alloc(n, align);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+static constexpr size_t default_align = alignof(std::max_align_t);
+
+void *operator new(size_t n) { return throwing_alloc(n, default_align); }
+void *operator new[](size_t n) { return throwing_alloc(n, default_align); }
+void *operator new(size_t n, const std::nothrow_t &) noexcept {
+    return tracked_alloc(n, default_align);
+}
+void *operator new[](size_t n, const std::nothrow_t &) noexcept {
+    return tracked_alloc(n, default_align);
+}
+void *operator new(size_t n, std::align_val_t a) {
+    return throwing_alloc(n, static_cast<size_t>(a));
+}
+void *operator new[](size_t n, std::align_val_t a) {
+    return throwing_alloc(n, static_cast<size_t>(a));
+}
+void *operator new(size_t n, std::align_val_t a, const std::nothrow_t &) noexcept {
+    return tracked_alloc(n, static_cast<size_t>(a));
+}
+void *operator new[](size_t n, std::align_val_t a, const std::nothrow_t &) noexcept {
+    return tracked_alloc(n, static_cast<size_t>(a));
+}
+
+void operator delete(void *p) noexcept { tracked_free(p, default_align); }
+void operator delete[](void *p) noexcept { tracked_free(p, default_align); }
+void operator delete(void *p, size_t) noexcept { tracked_free(p, default_align); }
+void operator delete[](void *p, size_t) noexcept { tracked_free(p, default_align); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { tracked_free(p, default_align); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+    tracked_free(p, default_align);
+}
+void operator delete(void *p, std::align_val_t a) noexcept {
+    tracked_free(p, static_cast<size_t>(a));
+}
+void operator delete[](void *p, std::align_val_t a) noexcept {
+    tracked_free(p, static_cast<size_t>(a));
+}
+void operator delete(void *p, size_t, std::align_val_t a) noexcept {
+    tracked_free(p, static_cast<size_t>(a));
+}
+void operator delete[](void *p, size_t, std::align_val_t a) noexcept {
+    tracked_free(p, static_cast<size_t>(a));
+}
+void operator delete(void *p, std::align_val_t a, const std::nothrow_t &) noexcept {
+    tracked_free(p, static_cast<size_t>(a));
+}
+void operator delete[](void *p, std::align_val_t a, const std::nothrow_t &) noexcept {
+    tracked_free(p, static_cast<size_t>(a));
+}
+
+static AllocStats read_counters(const char *name, const ScopeCounters &c) {
+    AllocStats s;
+    s.name = name;
+    s.allocations = c.allocations.load(std::memory_order_relaxed);
+    s.frees = c.frees.load(std::memory_order_relaxed);
+    s.bytes = c.bytes.load(std::memory_order_relaxed);
+    s.live = c.live.load(std::memory_order_relaxed);
+    s.peak = c.peak.load(std::memory_order_relaxed);
+    return s;
+}
+
+std::vector<AllocStats> alloc_stats() {
+    std::vector<AllocStats> out;
+    int n = scope_count.load();
+    out.reserve(n + 1);
+    for (int i = 0; i < n; ++i) {
+        if (scopes[i].allocations.load(std::memory_order_relaxed) == 0 && scopes[i].live == 0)
+            continue;
+        out.push_back(read_counters(i == 0 ? "other" : scopes[i].name, scopes[i]));
+    }
+    out.push_back(read_counters("total", total));
+    return out;
+}
+
+static void reset_counters(ScopeCounters &c) {
+    c.allocations = 0;
+    c.frees = 0;
+    c.bytes = 0;
+    c.peak = c.live.load();
+}
+
+void reset_alloc_stats() {
+    int n = scope_count.load();
+    for (int i = 0; i < n; ++i)
+        reset_counters(scopes[i]);
+    reset_counters(total);
+}
+
+#endif
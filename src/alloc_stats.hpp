@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Heap accounting for the STATS builtin. It is compiled in only when OPENCMD_ALLOC_STATS is
+// defined (make ALLOC_STATS=1): global operator new and delete are then replaced with versions
+// that charge every allocation to the scope the allocating thread is in. Without it the default
+// allocator is used and AllocScope compiles to nothing.
+//
+// Scopes are the phases of running a line ("expand", "tokenize", "parse", "execute") and, inside
+// "execute", the builtin being run or "external" while a program is started. A free is charged to
+// the scope that made the allocation, so live and peak are the bytes that scope still holds and
+// the most it held at once.
+
+struct AllocStats {
+    std::string name;
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t bytes = 0;
+    int64_t live = 0;
+    int64_t peak = 0;
+};
+
+#ifdef OPENCMD_ALLOC_STATS
+inline constexpr bool alloc_stats_enabled = true;
+
+// Charges the allocations of the current thread to a named scope until it is destroyed or moved
+// on with enter(). The name must outlive the program, as string literals do.
+class AllocScope {
+  private:
+    int previous;
+
+  public:
+    explicit AllocScope(const char *name);
+    ~AllocScope();
+    AllocScope(const AllocScope &) = delete;
+    AllocScope &operator=(const AllocScope &) = delete;
+
+    void enter(const char *name);
+};
+#else
+inline constexpr bool alloc_stats_enabled = false;
+
+class AllocScope {
+  public:
+    explicit AllocScope(const char *) {}
+    void enter(const char *) {}
+};
+#endif
+
+// One entry per scope that has allocated, in the order they were first seen, followed by the
+// process-wide "total". Empty when accounting is not compiled in.
+std::vector<AllocStats> alloc_stats();
+// Clears the counts; live bytes are kept and become the new peaks.
+void reset_alloc_stats();
+
+// The largest working set the process has had, in bytes.
+uint64_t peak_rss_bytes();
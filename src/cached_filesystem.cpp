@@ -0,0 +1,547 @@
+#include "filesystem.hpp"
+#include <algorithm>
+#include <cctype>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include "utf.hpp"
+#include <windows.h>
+#elif defined(__linux__)
+#include <cerrno>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Watches directories for changes to their entries and reports them to a callback, from its own
+// thread or from poll() on the calling one. A watch is named by a nonzero id; a report for id 0
+// means every watch may have missed changes, and lost means the watch has ended, for instance
+// because its directory was removed.
+class DirectoryWatcher {
+  public:
+    using Callback = std::function<void(uint64_t id, bool lost)>;
+
+  private:
+    Callback changed;
+    // Held while notifications are taken from the system and reported, so that poll() returns
+    // only after a batch the thread already took has been reported.
+    std::mutex processing;
+    std::mutex watch_lock;
+    std::thread thread;
+
+#ifdef _WIN32
+    struct Watch {
+        HANDLE dir = INVALID_HANDLE_VALUE;
+        OVERLAPPED overlapped{};
+        DWORD buffer[256];
+        bool retired = false;
+    };
+
+    static constexpr DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+                                    FILE_NOTIFY_CHANGE_ATTRIBUTES | FILE_NOTIFY_CHANGE_SIZE |
+                                    FILE_NOTIFY_CHANGE_LAST_WRITE;
+
+    HANDLE port = nullptr;
+    // A retired watch stays here until its cancelled read has completed, since the system writes
+    // into its buffer until then.
+    std::map<uint64_t, std::unique_ptr<Watch>> watches;
+    uint64_t next_id = 1;
+
+    // The records in the buffer are not read: any completion, including one that overflowed the
+    // buffer, drops the whole listing.
+    static bool arm(Watch &w) {
+        return ReadDirectoryChangesW(w.dir, w.buffer, sizeof(w.buffer), FALSE, filter, nullptr,
+                                     &w.overlapped, nullptr) != 0;
+    }
+
+    // Re-arms the watch a completion belongs to and reports it. Returns false for the packet
+    // that stops the thread.
+    bool handle(ULONG_PTR key, OVERLAPPED *overlapped) {
+        if (!overlapped)
+            return false;
+        bool lost;
+        {
+            std::lock_guard<std::mutex> guard(watch_lock);
+            auto it = watches.find(key);
+            if (it == watches.end())
+                return true;
+            if (it->second->retired) {
+                watches.erase(it);
+                return true;
+            }
+            lost = !arm(*it->second);
+            if (lost) {
+                CloseHandle(it->second->dir);
+                watches.erase(it);
+            }
+        }
+        changed(key, lost);
+        return true;
+    }
+
+    void run() {
+        while (true) {
+            DWORD bytes = 0;
+            ULONG_PTR key = 0;
+            OVERLAPPED *overlapped = nullptr;
+            BOOL ok = GetQueuedCompletionStatus(port, &bytes, &key, &overlapped, INFINITE);
+            if (!ok && !overlapped)
+                return;
+            std::lock_guard<std::mutex> guard(processing);
+            if (!handle(key, overlapped))
+                return;
+        }
+    }
+
+  public:
+    explicit DirectoryWatcher(Callback fn) : changed(std::move(fn)) {
+        port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (port)
+            thread = std::thread([this] { run(); });
+    }
+
+    ~DirectoryWatcher() {
+        if (!thread.joinable())
+            return;
+        PostQueuedCompletionStatus(port, 0, 0, nullptr);
+        thread.join();
+        size_t pending = 0;
+        {
+            std::lock_guard<std::mutex> guard(watch_lock);
+            for (auto &[id, w] : watches) {
+                if (w->retired)
+                    continue;
+                CancelIoEx(w->dir, &w->overlapped);
+                CloseHandle(w->dir);
+                w->retired = true;
+            }
+            pending = watches.size();
+        }
+        while (pending > 0) {
+            DWORD bytes = 0;
+            ULONG_PTR key = 0;
+            OVERLAPPED *overlapped = nullptr;
+            BOOL ok = GetQueuedCompletionStatus(port, &bytes, &key, &overlapped, 1000);
+            if (!ok && !overlapped)
+                break;
+            std::lock_guard<std::mutex> guard(watch_lock);
+            pending -= watches.erase(key);
+        }
+        CloseHandle(port);
+    }
+
+    uint64_t add(const std::string &path) {
+        if (!thread.joinable())
+            return 0;
+        HANDLE h = CreateFileW(widen(path).c_str(), FILE_LIST_DIRECTORY,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                               OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+                               nullptr);
+        if (h == INVALID_HANDLE_VALUE)
+            return 0;
+        std::lock_guard<std::mutex> guard(watch_lock);
+        uint64_t id = next_id++;
+        auto w = std::make_unique<Watch>();
+        w->dir = h;
+        // Reads issued here survive the calling thread, since the handle is tied to the port.
+        if (!CreateIoCompletionPort(h, port, id, 0) || !arm(*w)) {
+            CloseHandle(h);
+            return 0;
+        }
+        watches[id] = std::move(w);
+        return id;
+    }
+
+    void remove(uint64_t id) {
+        std::lock_guard<std::mutex> guard(watch_lock);
+        auto it = watches.find(id);
+        if (it == watches.end() || it->second->retired)
+            return;
+        it->second->retired = true;
+        CancelIoEx(it->second->dir, &it->second->overlapped);
+        CloseHandle(it->second->dir);
+    }
+
+    void poll() {
+        if (!thread.joinable())
+            return;
+        std::lock_guard<std::mutex> guard(processing);
+        while (true) {
+            DWORD bytes = 0;
+            ULONG_PTR key = 0;
+            OVERLAPPED *overlapped = nullptr;
+            BOOL ok = GetQueuedCompletionStatus(port, &bytes, &key, &overlapped, 0);
+            if (!ok && !overlapped)
+                return;
+            if (!handle(key, overlapped)) {
+                // The stop packet belongs to the thread.
+                PostQueuedCompletionStatus(port, 0, 0, nullptr);
+                return;
+            }
+        }
+    }
+#elif defined(__linux__)
+    int fd = -1;
+    int wake[2] = {-1, -1};
+    // The kernel hands out one watch per inode, so two paths to the same directory share it.
+    std::map<int, int> refs;
+
+    void process() {
+        std::lock_guard<std::mutex> guard(processing);
+        std::vector<std::pair<uint64_t, bool>> reports;
+        alignas(inotify_event) char buf[16384];
+        ssize_t n;
+        while ((n = read(fd, buf, sizeof(buf))) > 0) {
+            for (char *p = buf; p < buf + n;) {
+                const inotify_event *e = reinterpret_cast<const inotify_event *>(p);
+                p += sizeof(inotify_event) + e->len;
+                if (e->mask & IN_Q_OVERFLOW) {
+                    reports.emplace_back(0, false);
+                    continue;
+                }
+                bool lost = (e->mask & IN_IGNORED) != 0;
+                if (lost) {
+                    std::lock_guard<std::mutex> watches(watch_lock);
+                    refs.erase(e->wd);
+                }
+                reports.emplace_back(static_cast<uint64_t>(e->wd), lost);
+            }
+        }
+        std::sort(reports.begin(), reports.end());
+        reports.erase(std::unique(reports.begin(), reports.end()), reports.end());
+        for (const auto &[id, lost] : reports)
+            changed(id, lost);
+    }
+
+    void run() {
+        pollfd fds[2] = {{fd, POLLIN, 0}, {wake[0], POLLIN, 0}};
+        while (true) {
+            if (::poll(fds, 2, -1) < 0) {
+                if (errno == EINTR)
+                    continue;
+                return;
+            }
+            if (fds[1].revents)
+                return;
+            if (fds[0].revents)
+                process();
+        }
+    }
+
+  public:
+    explicit DirectoryWatcher(Callback fn) : changed(std::move(fn)) {
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0 || pipe(wake) != 0)
+            return;
+        thread = std::thread([this] { run(); });
+    }
+
+    ~DirectoryWatcher() {
+        if (thread.joinable()) {
+            char c = 0;
+            if (write(wake[1], &c, 1) == 1)
+                thread.join();
+            else
+                thread.detach();
+        }
+        for (int f : {fd, wake[0], wake[1]})
+            if (f >= 0)
+                close(f);
+    }
+
+    uint64_t add(const std::string &path) {
+        std::string p;
+        if (!thread.joinable() || !to_posix(path, p))
+            return 0;
+        int wd = inotify_add_watch(fd, p.c_str(),
+                                   IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM |
+                                       IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+        if (wd < 0)
+            return 0;
+        std::lock_guard<std::mutex> guard(watch_lock);
+        ++refs[wd];
+        return static_cast<uint64_t>(wd);
+    }
+
+    void remove(uint64_t id) {
+        std::lock_guard<std::mutex> guard(watch_lock);
+        auto it = refs.find(static_cast<int>(id));
+        if (it == refs.end() || --it->second > 0)
+            return;
+        inotify_rm_watch(fd, it->first);
+        refs.erase(it);
+    }
+
+    void poll() {
+        if (thread.joinable())
+            process();
+    }
+#else
+  public:
+    // No change notifications here, so nothing can be watched and nothing is cached.
+    explicit DirectoryWatcher(Callback fn) : changed(std::move(fn)) {}
+    uint64_t add(const std::string &) { return 0; }
+    void remove(uint64_t) {}
+    void poll() {}
+#endif
+};
+
+struct CachedFileSystem::Listing {
+    std::vector<FileEntry> entries;
+    // Indices into entries in name order, for stat().
+    std::vector<uint32_t> by_name;
+};
+
+struct CachedFileSystem::Dir {
+    uint64_t watch = 0;
+    // Bumped on every change, so a listing taken while one arrived is not stored.
+    uint64_t generation = 0;
+    // Null until the directory is listed and again after it changes.
+    std::shared_ptr<const Listing> listing;
+    std::list<std::string>::iterator recent;
+};
+
+static bool name_less(const std::string &a, const std::string &b) {
+    size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; i < n; ++i) {
+        int ca = std::toupper(static_cast<unsigned char>(a[i]));
+        int cb = std::toupper(static_cast<unsigned char>(b[i]));
+        if (ca != cb)
+            return ca < cb;
+    }
+    return a.size() < b.size();
+}
+
+// Paths differing only in case or a trailing separator name the same directory.
+static std::string dir_key(const std::string &path) {
+    std::string key = path;
+    for (char &c : key)
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    while (key.size() > 3 && key.back() == '\\')
+        key.pop_back();
+    return key;
+}
+
+static bool split_parent(const std::string &key, std::string &parent, std::string &name) {
+    size_t slash = key.find_last_of('\\');
+    if (slash == std::string::npos || slash + 1 >= key.size())
+        return false;
+    parent = key.substr(0, slash);
+    if (parent.size() == 2 && parent[1] == ':')
+        parent += '\\';
+    name = key.substr(slash + 1);
+    return true;
+}
+
+CachedFileSystem::CachedFileSystem(std::unique_ptr<FileSystem> backend, size_t max)
+    : inner(std::move(backend)), max_dirs(max),
+      watcher(std::make_unique<DirectoryWatcher>(
+          [this](uint64_t watch, bool lost) { changed(watch, lost); })) {}
+
+CachedFileSystem::~CachedFileSystem() = default;
+
+// Called with lock held. Moves the directory to the front of the LRU. Null if it is not cached.
+CachedFileSystem::Dir *CachedFileSystem::find_dir(const std::string &key) {
+    auto it = dirs.find(key);
+    if (it == dirs.end())
+        return nullptr;
+    recent.splice(recent.begin(), recent, it->second->recent);
+    return it->second.get();
+}
+
+// Called with lock held, with a watch started while it was not. If another thread cached the
+// directory in the meantime, its entry is kept and the new watch is returned in spare, for the
+// caller to remove once it has let go of the lock.
+CachedFileSystem::Dir *CachedFileSystem::add_dir(const std::string &key, uint64_t watch,
+                                                 uint64_t &spare) {
+    if (Dir *existing = find_dir(key)) {
+        spare = watch;
+        return existing;
+    }
+    auto dir = std::make_unique<Dir>();
+    dir->watch = watch;
+    recent.push_front(key);
+    dir->recent = recent.begin();
+    watched.emplace(watch, key);
+    Dir *raw = dir.get();
+    dirs.emplace(key, std::move(dir));
+    while (dirs.size() > max_dirs)
+        forget(recent.back());
+    return raw;
+}
+
+// Called with lock held.
+void CachedFileSystem::forget(const std::string &key) {
+    auto it = dirs.find(key);
+    if (it == dirs.end())
+        return;
+    uint64_t id = it->second->watch;
+    auto range = watched.equal_range(id);
+    for (auto w = range.first; w != range.second; ++w) {
+        if (w->second == key) {
+            watched.erase(w);
+            break;
+        }
+    }
+    recent.erase(it->second->recent);
+    dirs.erase(it);
+    watcher->remove(id);
+}
+
+void CachedFileSystem::changed(uint64_t watch, bool lost) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (watch == 0) {
+        for (auto &[key, dir] : dirs) {
+            dir->listing.reset();
+            ++dir->generation;
+        }
+        return;
+    }
+    std::vector<std::string> keys;
+    auto range = watched.equal_range(watch);
+    for (auto it = range.first; it != range.second; ++it)
+        keys.push_back(it->second);
+    for (const std::string &key : keys) {
+        if (lost) {
+            forget(key);
+            continue;
+        }
+        Dir &dir = *dirs[key];
+        dir.listing.reset();
+        ++dir.generation;
+    }
+}
+
+bool CachedFileSystem::get_current_dir(std::string &out) {
+    ++counters.cwd_queries;
+    return inner->get_current_dir(out);
+}
+
+bool CachedFileSystem::set_current_dir(const std::string &path) {
+    ++counters.cwd_changes;
+    return inner->set_current_dir(path);
+}
+
+bool CachedFileSystem::volume_info(char drive, VolumeInfo &out) {
+    ++counters.volume_queries;
+    return inner->volume_info(drive, out);
+}
+
+bool CachedFileSystem::stat(const std::string &path, FileEntry &out) {
+    watcher->poll();
+    std::string parent, name;
+    if (split_parent(dir_key(path), parent, name)) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = dirs.find(parent);
+        if (it != dirs.end() && it->second->listing) {
+            const Listing &l = *it->second->listing;
+            auto pos = std::lower_bound(
+                l.by_name.begin(), l.by_name.end(), name,
+                [&](uint32_t i, const std::string &n) { return name_less(l.entries[i].name, n); });
+            if (pos == l.by_name.end() || name_less(name, l.entries[*pos].name)) {
+                ++counters.cache_hits;
+                return false;
+            }
+            if (!l.entries[*pos].is_dir) {
+                ++counters.cache_hits;
+                // Named as asked for, as the backends do.
+                out = l.entries[*pos];
+                size_t end = path.find_last_not_of('\\') + 1;
+                out.name = path.substr(end - name.size(), name.size());
+                return true;
+            }
+        }
+    }
+    ++counters.stats;
+    return inner->stat(path, out);
+}
+
+bool CachedFileSystem::list_dir(const std::string &path,
+                                const std::function<void(const FileEntry &)> &fn) {
+    watcher->poll();
+    std::string key = dir_key(path);
+    std::shared_ptr<const Listing> listing;
+    uint64_t generation = 0;
+    bool watched_dir;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        Dir *dir = find_dir(key);
+        watched_dir = dir != nullptr;
+        if (dir) {
+            listing = dir->listing;
+            generation = dir->generation;
+        }
+    }
+    if (!watched_dir) {
+        // Starting a watch is a system call or two, which other threads need not wait for.
+        uint64_t watch = watcher->add(path);
+        uint64_t spare = 0;
+        if (watch) {
+            std::lock_guard<std::mutex> guard(lock);
+            Dir *dir = add_dir(key, watch, spare);
+            watched_dir = true;
+            listing = dir->listing;
+            generation = dir->generation;
+        }
+        if (spare)
+            watcher->remove(spare);
+    }
+    if (listing) {
+        ++counters.cache_hits;
+        for (const FileEntry &e : listing->entries)
+            fn(e);
+        return true;
+    }
+    ++counters.listings;
+    if (!watched_dir)
+        return inner->list_dir(path, fn);
+
+    // The watch is already in place, so a change made while listing bumps the generation and
+    // this listing is handed out once but not kept.
+    auto fresh = std::make_shared<Listing>();
+    bool ok = inner->list_dir(path, [&](const FileEntry &e) { fresh->entries.push_back(e); });
+    counters.entries_listed += fresh->entries.size();
+    if (!ok) {
+        std::lock_guard<std::mutex> guard(lock);
+        forget(key);
+        return false;
+    }
+    fresh->by_name.resize(fresh->entries.size());
+    for (uint32_t i = 0; i < fresh->by_name.size(); ++i)
+        fresh->by_name[i] = i;
+    std::sort(fresh->by_name.begin(), fresh->by_name.end(), [&](uint32_t a, uint32_t b) {
+        return name_less(fresh->entries[a].name, fresh->entries[b].name);
+    });
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = dirs.find(key);
+        if (it != dirs.end() && it->second->generation == generation) {
+            it->second->listing = fresh;
+        }
+    }
+    for (const FileEntry &e : fresh->entries)
+        fn(e);
+    return true;
+}
+
+bool CachedFileSystem::scan_dir(const std::string &path,
+                                const std::function<void(const FileEntry &)> &fn) {
+    watcher->poll();
+    std::shared_ptr<const Listing> listing;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = dirs.find(dir_key(path));
+        if (it != dirs.end())
+            listing = it->second->listing;
+    }
+    if (listing) {
+        ++counters.cache_hits;
+        for (const FileEntry &e : listing->entries)
+            fn(e);
+        return true;
+    }
+    ++counters.listings;
+    return inner->list_dir(path, fn);
+}
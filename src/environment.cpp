@@ -0,0 +1,353 @@
+#include "environment.hpp"
+#include <cctype>
+#include <cwchar>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include "utf.hpp"
+#include <windows.h>
+#else
+extern char **environ;
+#endif
+
+using NodePtr = std::shared_ptr<const EnvNode>;
+
+// Nodes are never modified after construction. The priority is derived from the key, which makes
+// the shape of the treap depend only on the set of names it holds and not on the order they were
+// set in.
+struct EnvNode {
+    std::string key;
+    std::string name;
+    std::string value;
+    uint32_t priority;
+    NodePtr left;
+    NodePtr right;
+};
+
+static std::string upper(const std::string &s) {
+    std::string out = s;
+    for (char &c : out)
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    return out;
+}
+
+static uint32_t key_priority(const std::string &key) {
+    // FNV-1a, finished with a multiplicative mix so that similar names get unrelated priorities.
+    uint32_t h = 2166136261u;
+    for (unsigned char c : key)
+        h = (h ^ c) * 16777619u;
+    h ^= h >> 15;
+    h *= 0x2c1b3c6du;
+    h ^= h >> 12;
+    return h;
+}
+
+// Orders nodes for the heap property; ties on the hash fall back to the key so the order is total.
+static bool outranks(const EnvNode &a, const EnvNode &b) {
+    return a.priority != b.priority ? a.priority > b.priority : a.key < b.key;
+}
+
+static NodePtr make_node(const EnvNode &from, NodePtr left, NodePtr right) {
+    auto n = std::make_shared<EnvNode>(from);
+    n->left = std::move(left);
+    n->right = std::move(right);
+    return n;
+}
+
+// Splits t into the keys below and above key. key itself must not be present.
+static std::pair<NodePtr, NodePtr> split(const NodePtr &t, const std::string &key) {
+    if (!t)
+        return {nullptr, nullptr};
+    if (t->key < key) {
+        auto [l, r] = split(t->right, key);
+        return {make_node(*t, t->left, std::move(l)), std::move(r)};
+    }
+    auto [l, r] = split(t->left, key);
+    return {std::move(l), make_node(*t, std::move(r), t->right)};
+}
+
+// Joins two treaps where every key of a sorts before every key of b.
+static NodePtr merge(const NodePtr &a, const NodePtr &b) {
+    if (!a)
+        return b;
+    if (!b)
+        return a;
+    if (outranks(*a, *b))
+        return make_node(*a, a->left, merge(a->right, b));
+    return make_node(*b, merge(a, b->left), b->right);
+}
+
+static NodePtr insert(const NodePtr &t, const EnvNode &node) {
+    if (!t || outranks(node, *t)) {
+        auto [l, r] = split(t, node.key);
+        return make_node(node, std::move(l), std::move(r));
+    }
+    if (node.key == t->key) {
+        EnvNode replaced = node;
+        replaced.name = t->name;
+        return make_node(replaced, t->left, t->right);
+    }
+    if (node.key < t->key)
+        return make_node(*t, insert(t->left, node), t->right);
+    return make_node(*t, t->left, insert(t->right, node));
+}
+
+static NodePtr erase(const NodePtr &t, const std::string &key) {
+    if (!t)
+        return t;
+    if (key == t->key)
+        return merge(t->left, t->right);
+    if (key < t->key) {
+        NodePtr l = erase(t->left, key);
+        return l == t->left ? t : make_node(*t, std::move(l), t->right);
+    }
+    NodePtr r = erase(t->right, key);
+    return r == t->right ? t : make_node(*t, t->left, std::move(r));
+}
+
+static const EnvNode *find(const EnvNode *n, const std::string &key) {
+    while (n && key != n->key)
+        n = key < n->key ? n->left.get() : n->right.get();
+    return n;
+}
+
+static std::mutex env_mutex;
+static NodePtr env_root;
+static bool env_loaded = false;
+
+// Changes not yet applied to the environment block: the keys that were set or removed since it was
+// last brought up to date, or a request to rebuild it when the whole tree was replaced.
+static std::vector<std::string> block_dirty_keys;
+static bool block_needs_rebuild = true;
+
+// Past this many pending changes, rebuilding is cheaper than patching one entry at a time.
+static constexpr size_t max_block_patches = 64;
+
+static void mark_block_dirty(const std::string &key) {
+    if (block_needs_rebuild)
+        return;
+    if (block_dirty_keys.size() >= max_block_patches) {
+        block_needs_rebuild = true;
+        block_dirty_keys.clear();
+        return;
+    }
+    block_dirty_keys.push_back(key);
+}
+
+static void add_entry(const std::string &entry) {
+    // Entries such as "=C:=C:\dir" hold per-drive directories and are not variables.
+    size_t eq = entry.find('=', 1);
+    if (entry.empty() || entry[0] == '=' || eq == std::string::npos)
+        return;
+    EnvNode node;
+    node.name = entry.substr(0, eq);
+    node.key = upper(node.name);
+    node.value = entry.substr(eq + 1);
+    node.priority = key_priority(node.key);
+    env_root = insert(env_root, node);
+}
+
+static void load_process_environment() {
+    if (env_loaded)
+        return;
+    env_loaded = true;
+#ifdef _WIN32
+    wchar_t *block = GetEnvironmentStringsW();
+    if (!block)
+        return;
+    for (const wchar_t *p = block; *p; p += std::wcslen(p) + 1)
+        add_entry(narrow(p));
+    FreeEnvironmentStringsW(block);
+#else
+    for (char **p = environ; p && *p; ++p)
+        add_entry(*p);
+#endif
+}
+
+bool get_env_var(const std::string &name, std::string &value) {
+    std::string key = upper(name);
+    std::lock_guard<std::mutex> lock(env_mutex);
+    load_process_environment();
+    const EnvNode *n = find(env_root.get(), key);
+    if (!n)
+        return false;
+    value = n->value;
+    return true;
+}
+
+void set_env_var(const std::string &name, const std::string &value) {
+    if (name.empty())
+        return;
+    std::lock_guard<std::mutex> lock(env_mutex);
+    load_process_environment();
+    std::string key = upper(name);
+    mark_block_dirty(key);
+    if (value.empty()) {
+        env_root = erase(env_root, key);
+        return;
+    }
+    EnvNode node;
+    node.name = name;
+    node.key = std::move(key);
+    node.value = value;
+    node.priority = key_priority(node.key);
+    env_root = insert(env_root, node);
+}
+
+static void visit(const EnvNode *n, const std::string &prefix,
+                  const std::function<void(const std::string &, const std::string &)> &fn) {
+    if (!n)
+        return;
+    // Only descend into subtrees that can hold keys starting with prefix.
+    bool left_possible = prefix.empty() || n->key.compare(0, prefix.size(), prefix) >= 0;
+    bool right_possible = prefix.empty() || n->key.compare(0, prefix.size(), prefix) <= 0;
+    if (left_possible)
+        visit(n->left.get(), prefix, fn);
+    if (n->key.compare(0, prefix.size(), prefix) == 0)
+        fn(n->name, n->value);
+    if (right_possible)
+        visit(n->right.get(), prefix, fn);
+}
+
+void for_each_env_var(const std::string &prefix,
+                      const std::function<void(const std::string &, const std::string &)> &fn) {
+    NodePtr root;
+    {
+        std::lock_guard<std::mutex> lock(env_mutex);
+        load_process_environment();
+        root = env_root;
+    }
+    // The snapshot is immutable, so the walk needs no lock and fn may call SET.
+    visit(root.get(), upper(prefix), fn);
+}
+
+EnvSnapshot env_snapshot() {
+    std::lock_guard<std::mutex> lock(env_mutex);
+    load_process_environment();
+    EnvSnapshot snap;
+    snap.root = env_root;
+    return snap;
+}
+
+void env_restore(const EnvSnapshot &snapshot) {
+    std::lock_guard<std::mutex> lock(env_mutex);
+    if (env_root != snapshot.root) {
+        block_needs_rebuild = true;
+        block_dirty_keys.clear();
+    }
+    env_root = snapshot.root;
+}
+
+#ifdef _WIN32
+using BlockChar = wchar_t;
+
+static std::wstring block_text(const std::string &s) { return widen(s); }
+#else
+using BlockChar = char;
+
+static const std::string &block_text(const std::string &s) { return s; }
+#endif
+
+// The block holds one "NAME=VALUE\0" string per variable in key order, followed by the final
+// terminator. Each slot records where its string starts so that a change can be spliced into
+// place; the strings after it shift by the difference in length.
+struct BlockSlot {
+    std::string key;
+    size_t offset;
+    size_t length;
+};
+
+static std::mutex block_mutex;
+static std::basic_string<BlockChar> block;
+static std::vector<BlockSlot> block_slots;
+#ifndef _WIN32
+static std::vector<char *> block_pointers;
+#endif
+
+static std::basic_string<BlockChar> block_entry(const EnvNode &n) {
+    std::basic_string<BlockChar> entry(block_text(n.name));
+    entry += BlockChar('=');
+    entry += block_text(n.value);
+    entry += BlockChar(0);
+    return entry;
+}
+
+static void append_block_entries(const EnvNode *n) {
+    if (!n)
+        return;
+    append_block_entries(n->left.get());
+    std::basic_string<BlockChar> entry = block_entry(*n);
+    block_slots.push_back({n->key, block.size(), entry.size()});
+    block += entry;
+    append_block_entries(n->right.get());
+}
+
+static void rebuild_block(const EnvNode *root) {
+    block.clear();
+    block_slots.clear();
+    append_block_entries(root);
+    block += BlockChar(0);
+}
+
+// Brings the entry for key in line with the tree: replaces it, inserts it at its sorted position
+// or removes it.
+static void patch_block(const EnvNode *root, const std::string &key) {
+    auto before = [](const BlockSlot &s, const std::string &k) { return s.key < k; };
+    auto slot = std::lower_bound(block_slots.begin(), block_slots.end(), key, before);
+    bool present = slot != block_slots.end() && slot->key == key;
+    const EnvNode *n = find(root, key);
+    if (!n && !present)
+        return;
+
+    size_t offset = slot != block_slots.end() ? slot->offset : block.size() - 1;
+    size_t old_length = present ? slot->length : 0;
+    std::basic_string<BlockChar> entry;
+    if (n)
+        entry = block_entry(*n);
+    block.replace(offset, old_length, entry);
+
+    if (!n)
+        slot = block_slots.erase(slot);
+    else if (present)
+        (slot++)->length = entry.size();
+    else
+        slot = block_slots.insert(slot, {key, offset, entry.size()}) + 1;
+    for (; slot != block_slots.end(); ++slot)
+        slot->offset = slot->offset + entry.size() - old_length;
+}
+
+void with_env_block(const std::function<void(EnvBlock)> &fn) {
+    std::lock_guard<std::mutex> lock(block_mutex);
+    NodePtr root;
+    std::vector<std::string> dirty;
+    bool needs_rebuild;
+    {
+        std::lock_guard<std::mutex> env_lock(env_mutex);
+        load_process_environment();
+        root = env_root;
+        dirty.swap(block_dirty_keys);
+        needs_rebuild = block_needs_rebuild;
+        block_needs_rebuild = false;
+    }
+    if (needs_rebuild) {
+        rebuild_block(root.get());
+    } else {
+        for (const auto &key : dirty)
+            patch_block(root.get(), key);
+    }
+#ifdef _WIN32
+    fn(block.data());
+#else
+    if (needs_rebuild || !dirty.empty()) {
+        block_pointers.clear();
+        for (const auto &slot : block_slots)
+            block_pointers.push_back(block.data() + slot.offset);
+        block_pointers.push_back(nullptr);
+    }
+    fn(block_pointers.data());
+#endif
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+// Shell variables live in a persistent (immutable, structurally shared) treap keyed by the
+// upper-cased name, so a snapshot of the whole environment is a single pointer copy. SET replaces
+// only the nodes on the path to the changed variable; every other node stays shared with older
+// snapshots. Names compare case-insensitively and keep the case they were first set with.
+//
+// The environment starts as a copy of the process environment and is not written back to it.
+
+struct EnvNode;
+
+class EnvSnapshot {
+  private:
+    std::shared_ptr<const EnvNode> root;
+    friend EnvSnapshot env_snapshot();
+    friend void env_restore(const EnvSnapshot &snapshot);
+
+  public:
+    EnvSnapshot() = default;
+};
+
+bool get_env_var(const std::string &name, std::string &value);
+// An empty value removes the variable, as "SET NAME=" does.
+void set_env_var(const std::string &name, const std::string &value);
+// Visits the variables whose name starts with prefix (case-insensitively), in name order.
+void for_each_env_var(const std::string &prefix,
+                      const std::function<void(const std::string &, const std::string &)> &fn);
+
+EnvSnapshot env_snapshot();
+void env_restore(const EnvSnapshot &snapshot);
+
+// The environment in the form a child process takes it: on Windows a block of UTF-16
+// "NAME=VALUE" strings sorted by name and ended by an empty string, for CreateProcessW with
+// CREATE_UNICODE_ENVIRONMENT; elsewhere the envp array for posix_spawn.
+//
+// The block is kept between calls. SET records which names changed and only those entries are
+// spliced into place the next time the block is needed; SETLOCAL/ENDLOCAL or a large batch of
+// changes rebuild it instead. fn runs under the block's lock, so the pointer it receives must not
+// be used after it returns.
+#ifdef _WIN32
+using EnvBlock = wchar_t *;
+#else
+using EnvBlock = char *const *;
+#endif
+void with_env_block(const std::function<void(EnvBlock)> &fn);
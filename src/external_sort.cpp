@@ -0,0 +1,422 @@
+#include "external_sort.hpp"
+#include "worker_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+static constexpr std::array<unsigned char, 256> make_case_fold() {
+    std::array<unsigned char, 256> t{};
+    for (unsigned c = 0; c < 256; ++c)
+        t[c] = static_cast<unsigned char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+    return t;
+}
+
+static constexpr std::array<unsigned char, 256> case_fold = make_case_fold();
+
+struct LineOrder {
+    size_t column;
+    bool reverse;
+
+    static int compare_folded(std::string_view a, std::string_view b) {
+        size_t n = std::min(a.size(), b.size());
+        for (size_t i = 0; i < n; ++i) {
+            unsigned char x = case_fold[static_cast<unsigned char>(a[i])];
+            unsigned char y = case_fold[static_cast<unsigned char>(b[i])];
+            if (x != y)
+                return x < y ? -1 : 1;
+        }
+        return a.size() == b.size() ? 0 : a.size() < b.size() ? -1 : 1;
+    }
+
+    bool operator()(std::string_view a, std::string_view b) const {
+        int c = compare_folded(a.substr(std::min(column, a.size())),
+                               b.substr(std::min(column, b.size())));
+        if (c == 0)
+            c = a.compare(b);
+        return reverse ? c > 0 : c < 0;
+    }
+};
+
+// Merges k sorted sources. The tree keeps the loser of every match between two subtrees, so after
+// the winner is taken only the matches on the path from its leaf to the root are replayed: one
+// comparison per level, log2(k) per line, where a linear scan of the heads would need k - 1.
+//
+// Source::next(line) returns the source's next line, which must stay valid until next() is called
+// on the same source again.
+template <class Source> class LoserTree {
+  private:
+    std::vector<Source> &sources;
+    const LineOrder &order;
+    size_t k;
+    std::vector<std::string_view> heads;
+    std::vector<char> live;
+    std::vector<size_t> losers;
+
+    bool beats(size_t a, size_t b) const {
+        if (!live[a] || !live[b])
+            return live[a] != live[b] ? live[a] : a < b;
+        if (order(heads[a], heads[b]))
+            return true;
+        return !order(heads[b], heads[a]) && a < b;
+    }
+
+    size_t build(size_t node) {
+        if (node >= k)
+            return node - k;
+        size_t a = build(2 * node);
+        size_t b = build(2 * node + 1);
+        if (beats(a, b)) {
+            losers[node] = b;
+            return a;
+        }
+        losers[node] = a;
+        return b;
+    }
+
+  public:
+    LoserTree(std::vector<Source> &s, const LineOrder &o)
+        : sources(s), order(o), k(s.size()), heads(k), live(k), losers(std::max<size_t>(k, 1)) {
+        for (size_t i = 0; i < k; ++i)
+            live[i] = sources[i].next(heads[i]);
+        losers[0] = k > 1 ? build(1) : 0;
+    }
+
+    // The smallest remaining line, or null when every source is exhausted.
+    const std::string_view *top() const {
+        return k && live[losers[0]] ? &heads[losers[0]] : nullptr;
+    }
+
+    void pop() {
+        size_t winner = losers[0];
+        live[winner] = sources[winner].next(heads[winner]);
+        for (size_t node = (winner + k) / 2; node >= 1; node /= 2)
+            if (beats(losers[node], winner))
+                std::swap(losers[node], winner);
+        losers[0] = winner;
+    }
+};
+
+struct PartSource {
+    const std::string_view *it;
+    const std::string_view *end;
+
+    bool next(std::string_view &line) {
+        if (it == end)
+            return false;
+        line = *it++;
+        return true;
+    }
+};
+
+// A sorted run spilled to a temporary file, which the system deletes when it is closed. It is
+// written once, then rewound and read back line by line.
+class TempRun {
+  private:
+    NativeHandle file = no_handle;
+    std::string buffer;
+    size_t read_pos = 0;
+    size_t read_end = 0;
+    bool at_eof = false;
+    bool failed = false;
+
+    bool flush() {
+        if (!write_handle(file, buffer.data(), buffer.size()))
+            return false;
+        buffer.clear();
+        return true;
+    }
+
+  public:
+    static constexpr size_t write_buffer_size = size_t(1) << 20;
+
+    ~TempRun() {
+        if (file != no_handle)
+            close_handle(file);
+    }
+
+    bool create(const std::string &dir) {
+        file = create_temp_file(dir);
+        if (file == no_handle)
+            return false;
+        buffer.reserve(write_buffer_size);
+        return true;
+    }
+
+    bool write(std::string_view line) {
+        buffer.append(line);
+        buffer.push_back('\n');
+        return buffer.size() < write_buffer_size || flush();
+    }
+
+    bool finish_writing() {
+        return flush() && rewind_handle(file);
+    }
+
+    void start_reading(size_t buffer_size) {
+        buffer.assign(buffer_size, '\0');
+        buffer.shrink_to_fit();
+    }
+
+    bool next(std::string_view &line) {
+        while (true) {
+            const char *base = buffer.data();
+            const char *nl = static_cast<const char *>(
+                std::memchr(base + read_pos, '\n', read_end - read_pos));
+            if (nl) {
+                line = std::string_view(base + read_pos, nl - (base + read_pos));
+                read_pos = nl - base + 1;
+                return true;
+            }
+            if (at_eof) {
+                if (read_pos == read_end)
+                    return false;
+                line = std::string_view(base + read_pos, read_end - read_pos);
+                read_pos = read_end;
+                return true;
+            }
+            // Keep the partial line and refill behind it, growing the buffer for long lines.
+            std::memmove(buffer.data(), base + read_pos, read_end - read_pos);
+            read_end -= read_pos;
+            read_pos = 0;
+            if (read_end == buffer.size())
+                buffer.resize(buffer.size() * 2);
+            size_t got = 0;
+            if (!read_handle(file, buffer.data() + read_end, buffer.size() - read_end, got)) {
+                failed = true;
+                got = 0;
+            }
+            read_end += got;
+            at_eof = got == 0;
+        }
+    }
+
+    bool read_failed() const { return failed; }
+};
+
+struct RunSource {
+    TempRun *run;
+
+    bool next(std::string_view &line) { return run->next(line); }
+};
+
+static void write_line(std::ostream &out, std::string_view line) {
+    out.write(line.data(), static_cast<std::streamsize>(line.size()));
+    out.put('\n');
+}
+
+static void split_lines(const char *p, const char *end, std::vector<std::string_view> &lines) {
+    lines.clear();
+    while (p < end) {
+        const char *nl = static_cast<const char *>(std::memchr(p, '\n', end - p));
+        const char *stop = nl ? nl : end;
+        const char *line_end = stop > p && stop[-1] == '\r' ? stop - 1 : stop;
+        lines.emplace_back(p, line_end - p);
+        p = nl ? nl + 1 : end;
+    }
+}
+
+class Sorter {
+  private:
+    // Parts are kept around this size even with few threads: sorting several parts that fit in
+    // cache and merging them beats one large sort whose comparisons miss the cache.
+    static constexpr size_t part_lines = 65536;
+
+    const SortOptions &options;
+    LineOrder order;
+    std::ostream &out;
+    std::string &error;
+    std::vector<std::unique_ptr<TempRun>> runs;
+
+  public:
+    Sorter(const SortOptions &o, std::ostream &os, std::string &e)
+        : options(o), order{o.column, o.reverse}, out(os), error(e) {}
+
+    // Sorts one run of lines. The run that completes an input which never spilled is written to
+    // out directly; any other run goes to a temporary file.
+    bool add(std::vector<std::string_view> &lines, bool last) {
+        unsigned jobs = options.jobs ? options.jobs : WorkerPool::default_jobs();
+        size_t count = std::max<size_t>(1, (lines.size() + part_lines - 1) / part_lines);
+        std::vector<size_t> bounds(count + 1);
+        for (size_t p = 0; p <= count; ++p)
+            bounds[p] = lines.size() * p / count;
+        if (count == 1) {
+            std::sort(lines.begin(), lines.end(), order);
+        } else {
+            WorkerPool pool(jobs, count, [&](size_t p) {
+                std::sort(lines.begin() + bounds[p], lines.begin() + bounds[p + 1], order);
+            });
+            pool.wait();
+        }
+
+        std::vector<PartSource> parts;
+        for (size_t p = 0; p < count; ++p)
+            parts.push_back({lines.data() + bounds[p], lines.data() + bounds[p + 1]});
+        LoserTree<PartSource> tree(parts, order);
+        if (last && runs.empty()) {
+            for (; tree.top(); tree.pop())
+                write_line(out, *tree.top());
+            return true;
+        }
+
+        auto run = std::make_unique<TempRun>();
+        if (!run->create(options.temp_dir)) {
+            error = "The temporary file could not be created.";
+            return false;
+        }
+        for (; tree.top(); tree.pop()) {
+            if (!run->write(*tree.top())) {
+                error = "There is not enough space on the disk for the temporary file.";
+                return false;
+            }
+        }
+        if (!run->finish_writing()) {
+            error = "There is not enough space on the disk for the temporary file.";
+            return false;
+        }
+        runs.push_back(std::move(run));
+        return true;
+    }
+
+    // Merges the spilled runs into out, sharing the memory limit between their read buffers.
+    bool finish() {
+        if (runs.empty())
+            return true;
+        size_t buffer_size = std::max<size_t>(size_t(64) << 10, options.memory_limit / runs.size());
+        std::vector<RunSource> sources;
+        for (auto &run : runs) {
+            run->start_reading(buffer_size);
+            sources.push_back({run.get()});
+        }
+        LoserTree<RunSource> tree(sources, order);
+        for (; tree.top(); tree.pop())
+            write_line(out, *tree.top());
+        for (auto &run : runs) {
+            if (run->read_failed()) {
+                error = "The temporary file could not be read.";
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Sorts mapped file contents in runs that end at a line break; the lines stay views into the
+// mapping until they are written out.
+static bool sort_mapped(const char *data, size_t size, size_t limit, Sorter &sorter) {
+    std::vector<std::string_view> lines;
+    size_t pos = 0;
+    while (pos < size) {
+        size_t end = std::min(size, pos + limit);
+        if (end < size) {
+            const char *nl = static_cast<const char *>(std::memchr(data + end, '\n', size - end));
+            end = nl ? nl - data + 1 : size;
+        }
+        split_lines(data + pos, data + end, lines);
+        if (!sorter.add(lines, end == size))
+            return false;
+        pos = end;
+    }
+    return sorter.finish();
+}
+
+// Sorts a pipe or the console, which can only be read once, in runs of up to limit bytes. The
+// buffer starts small and doubles as input arrives, so short input costs no more than it needs;
+// only a full buffer of limit bytes is sorted as a run before the end. A line cut off at the end
+// of a run moves to the start of the next one.
+static bool sort_streamed(NativeHandle in, size_t limit, Sorter &sorter) {
+    constexpr size_t initial_size = size_t(64) << 10;
+    size_t run_size = std::max(limit, initial_size);
+    std::string buffer(initial_size, '\0');
+    std::vector<std::string_view> lines;
+    size_t filled = 0;
+    bool at_eof = false;
+    while (!at_eof) {
+        while (!at_eof && filled < buffer.size()) {
+            size_t got = 0;
+            // A broken pipe is how the writing end reports that it has finished.
+            if (!read_handle(in, buffer.data() + filled, buffer.size() - filled, got) || got == 0)
+                at_eof = true;
+            filled += got;
+        }
+        if (!at_eof && buffer.size() < run_size) {
+            buffer.resize(std::min(buffer.size() * 2, run_size));
+            continue;
+        }
+        size_t end = filled;
+        if (!at_eof) {
+            size_t nl = buffer.rfind('\n', filled - 1);
+            if (nl == std::string::npos) {
+                buffer.resize(buffer.size() * 2);
+                continue;
+            }
+            end = nl + 1;
+        }
+        split_lines(buffer.data(), buffer.data() + end, lines);
+        if (!sorter.add(lines, at_eof))
+            return false;
+        std::memmove(buffer.data(), buffer.data() + end, filled - end);
+        filled -= end;
+    }
+    return sorter.finish();
+}
+
+// The whole of a disk file, read-only, or nothing if it cannot be mapped.
+class FileView {
+  private:
+#ifdef _WIN32
+    HANDLE mapping = nullptr;
+#endif
+    const void *view = nullptr;
+    size_t length = 0;
+
+  public:
+    FileView(NativeHandle file, size_t size) : length(size) {
+#ifdef _WIN32
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+#else
+        void *p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        view = p == MAP_FAILED ? nullptr : p;
+#endif
+    }
+    ~FileView() {
+#ifdef _WIN32
+        if (view)
+            UnmapViewOfFile(view);
+        if (mapping)
+            CloseHandle(mapping);
+#else
+        if (view)
+            munmap(const_cast<void *>(view), length);
+#endif
+    }
+    FileView(const FileView &) = delete;
+    FileView &operator=(const FileView &) = delete;
+
+    const char *data() const { return static_cast<const char *>(view); }
+};
+
+bool sort_lines(NativeHandle in, std::ostream &out, const SortOptions &options,
+                std::string &error) {
+    Sorter sorter(options, out, error);
+    size_t limit = std::max<size_t>(options.memory_limit, 1);
+    uint64_t size = 0;
+    if (!disk_file_size(in, size))
+        return sort_streamed(in, limit, sorter);
+    if (size == 0)
+        return true;
+
+    // Mapping can fail, for example when the file does not fit in the address space; such files
+    // are read like a pipe instead.
+    FileView view(in, static_cast<size_t>(size));
+    if (!view.data())
+        return sort_streamed(in, limit, sorter);
+    return sort_mapped(view.data(), static_cast<size_t>(size), limit, sorter);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "native_io.hpp"
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+struct SortOptions {
+    bool reverse = false;
+    // /+n: lines are compared from this 0-based column on; shorter lines compare as empty.
+    size_t column = 0;
+    // Bytes of line data held in memory at once. Larger inputs are sorted in runs of this size
+    // that are spilled to temporary files and merged at the end.
+    size_t memory_limit = size_t(256) << 20;
+    // Threads that sort a run, 0 for one per processor.
+    unsigned jobs = 0;
+    // Where runs are spilled; empty for the system temporary directory.
+    std::string temp_dir;
+};
+
+// Sorts the lines read from in and writes them to out, one per line. Lines compare
+// case-insensitively (ASCII), with ties broken by their bytes so the order is total.
+//
+// A disk file is mapped rather than read, and its lines are sorted in place as views into the
+// mapping; pipes and the console are read in runs of memory_limit bytes. Each run is split into
+// cache-sized parts that are sorted in parallel and merged with a loser tree, and the result goes
+// straight to out if it was the whole input or to a temporary file otherwise. The temporary files
+// are merged with another loser tree at the end.
+//
+// Returns false with a message in error if a temporary file could not be created or written.
+bool sort_lines(NativeHandle in, std::ostream &out, const SortOptions &options, std::string &error);
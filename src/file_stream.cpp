@@ -0,0 +1,170 @@
+#include "file_stream.hpp"
+#include "environment.hpp"
+#include <system_error>
+
+#ifdef _WIN32
+static constexpr bool crlf_line_ends = true;
+#else
+static constexpr bool crlf_line_ends = false;
+#endif
+
+FileOutputStream::Buffer::Buffer(NativeHandle h, bool behind, bool translate_line_ends)
+    : file(h), write_behind(behind), crlf(translate_line_ends) {
+    setp(data, data + sizeof(data));
+}
+
+FileOutputStream::Buffer::~Buffer() { stop_writer(); }
+
+// Writes n bytes, turning each bare "\n" into "\r\n" when crlf is set. The translation goes
+// through a buffer kept at twice the largest block written so far, so a block is still one write.
+bool FileOutputStream::Buffer::write_all(const char *p, size_t n) {
+    if (!crlf || n == 0)
+        return write_handle(file, p, n);
+    if (translated.size() < 2 * n)
+        translated.resize(2 * n);
+    char *out = translated.data();
+    for (size_t i = 0; i < n; ++i) {
+        if (p[i] == '\n' && !last_was_cr)
+            *out++ = '\r';
+        *out++ = p[i];
+        last_was_cr = p[i] == '\r';
+    }
+    return write_handle(file, translated.data(), out - translated.data());
+}
+
+bool FileOutputStream::Buffer::write_out() {
+    if (!write_all(pbase(), pptr() - pbase()))
+        return false;
+    setp(data, data + sizeof(data));
+    return true;
+}
+
+// Called once the first buffer has been written. If no thread can be started the stream simply
+// stays synchronous.
+void FileOutputStream::Buffer::start_writer() {
+    chunks.reset(new char[chunk_size * chunk_count]);
+    try {
+        writer = std::thread(&Buffer::write_chunks, this);
+    } catch (const std::system_error &) {
+        chunks.reset();
+        write_behind = false;
+        return;
+    }
+    setp(chunks.get(), chunks.get() + chunk_size);
+}
+
+// Queues the chunk being filled and moves on to the next one, waiting while the writer still has
+// it.
+bool FileOutputStream::Buffer::submit() {
+    std::unique_lock<std::mutex> guard(lock);
+    if (failed)
+        return false;
+    chunk_used[(head + queued) % chunk_count] = pptr() - pbase();
+    ++queued;
+    work_ready.notify_one();
+    space_ready.wait(guard, [&] { return queued < chunk_count || failed; });
+    if (failed)
+        return false;
+    char *next = chunks.get() + (head + queued) % chunk_count * chunk_size;
+    setp(next, next + chunk_size);
+    return true;
+}
+
+bool FileOutputStream::Buffer::drain() {
+    if (pptr() > pbase() && !submit())
+        return false;
+    std::unique_lock<std::mutex> guard(lock);
+    space_ready.wait(guard, [&] { return queued == 0; });
+    return !failed;
+}
+
+// The writer thread. A failed write drops everything queued behind it, so the file never has a
+// gap followed by later output.
+void FileOutputStream::Buffer::write_chunks() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+        work_ready.wait(guard, [&] { return queued > 0 || stopping; });
+        if (queued == 0)
+            return;
+        size_t index = head;
+        guard.unlock();
+        bool ok = write_all(chunks.get() + index * chunk_size, chunk_used[index]);
+        guard.lock();
+        if (ok) {
+            head = (head + 1) % chunk_count;
+            --queued;
+        } else {
+            failed = true;
+            queued = 0;
+        }
+        space_ready.notify_all();
+    }
+}
+
+void FileOutputStream::Buffer::stop_writer() {
+    if (!writer.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    work_ready.notify_one();
+    writer.join();
+}
+
+void FileOutputStream::Buffer::finish() {
+    sync();
+    stop_writer();
+}
+
+FileOutputStream::Buffer::int_type FileOutputStream::Buffer::overflow(int_type c) {
+    if (writer.joinable()) {
+        if (!submit())
+            return traits_type::eof();
+    } else {
+        if (!write_out())
+            return traits_type::eof();
+        if (write_behind)
+            start_writer();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+int FileOutputStream::Buffer::sync() {
+    bool ok = writer.joinable() ? drain() : write_out();
+    return ok ? 0 : -1;
+}
+
+// Disk files only, and only with a second processor to write while this one formats.
+static bool wants_write_behind(NativeHandle h) {
+    if (h == no_handle || std::thread::hardware_concurrency() < 2 || !is_disk_file(h))
+        return false;
+    std::string setting;
+    return !get_env_var("OPENCMD_WRITE_BEHIND", setting) || setting != "0";
+}
+
+FileOutputStream::FileOutputStream(const std::string &path, bool append)
+    : std::ostream(nullptr), file(open_for_writing(path, append, denied)),
+      buffer(file, wants_write_behind(file), crlf_line_ends) {
+    if (is_open()) {
+        rdbuf(&buffer);
+    } else {
+        setstate(std::ios::badbit);
+    }
+}
+
+FileOutputStream::FileOutputStream(NativeHandle h)
+    : std::ostream(nullptr), file(h), buffer(file, wants_write_behind(file), crlf_line_ends) {
+    rdbuf(&buffer);
+}
+
+FileOutputStream::~FileOutputStream() {
+    if (!is_open())
+        return;
+    buffer.finish();
+    close_handle(file);
+}
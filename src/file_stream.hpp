@@ -0,0 +1,94 @@
+#pragma once
+
+#include "native_io.hpp"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The target of an output redirection or the writing side of a pipe. Builtins write through the
+// stream; child processes are handed handle() and write to it directly, so the stream is flushed
+// before one starts.
+//
+// Output to a disk file is written behind on machines with more than one processor: once it
+// outgrows the first buffer, a writer thread is started and the stream fills one chunk of a small
+// ring while the thread writes the ones before it, in order. A flush waits until everything queued
+// is on disk, so a child started afterwards appends after it. If a write fails, nothing queued
+// after it is written and the stream fails at its next write or flush, as it would have at the
+// failing write itself. Setting OPENCMD_WRITE_BEHIND=0 writes synchronously, for comparison. Pipes
+// are always written synchronously, since their reader is waiting for the data.
+//
+// On Windows each "\n" is written as "\r\n", as CMD ends the lines it writes; a "\n" that already
+// follows a "\r" is left alone, so output copied from a child process keeps its line ends.
+class FileOutputStream : public std::ostream {
+  private:
+    class Buffer : public std::streambuf {
+      private:
+        static constexpr size_t chunk_size = 64 * 1024;
+        static constexpr size_t chunk_count = 4;
+
+        NativeHandle file;
+        bool write_behind = false;
+        bool crlf = false;
+        char data[8192];
+
+        // Owned by whichever thread calls write_all: this one until the writer starts, the
+        // writer afterwards.
+        std::vector<char> translated;
+        bool last_was_cr = false;
+
+        // The ring: chunks [head, head + queued) wait for the writer and chunk (head + queued)
+        // is being filled. All of it exists only once the writer has started.
+        std::unique_ptr<char[]> chunks;
+        size_t chunk_used[chunk_count] = {};
+        size_t head = 0;
+        size_t queued = 0;
+        bool stopping = false;
+        bool failed = false;
+        std::mutex lock;
+        std::condition_variable work_ready;
+        std::condition_variable space_ready;
+        std::thread writer;
+
+        bool write_all(const char *p, size_t n);
+        bool write_out();
+        void start_writer();
+        bool submit();
+        bool drain();
+        void write_chunks();
+        void stop_writer();
+
+      protected:
+        int_type overflow(int_type c) override;
+        int sync() override;
+
+      public:
+        Buffer(NativeHandle h, bool behind, bool translate_line_ends);
+        ~Buffer();
+        // Flushes everything and stops the writer thread; the handle can be closed afterwards.
+        void finish();
+    };
+
+    // Set while file is opened, so it comes first.
+    bool denied = false;
+    NativeHandle file;
+    Buffer buffer;
+
+  public:
+    // Opens path for writing, truncating it unless append is set. Check is_open() afterwards.
+    FileOutputStream(const std::string &path, bool append);
+    // Takes over an open handle, such as the write end of a pipe, and closes it when destroyed.
+    explicit FileOutputStream(NativeHandle h);
+    ~FileOutputStream();
+    FileOutputStream(const FileOutputStream &) = delete;
+    FileOutputStream &operator=(const FileOutputStream &) = delete;
+
+    bool is_open() const { return file != no_handle; }
+    // Whether opening failed for lack of permission.
+    bool access_denied() const { return denied; }
+    NativeHandle handle() const { return file; }
+};
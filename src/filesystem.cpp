@@ -0,0 +1,256 @@
+#include "filesystem.hpp"
+#include "utf.hpp"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+
+static std::time_t filetime_to_time_t(const FILETIME &ft) {
+    // FILETIME counts 100ns ticks since 1601-01-01; time_t counts seconds since 1970-01-01.
+    uint64_t ticks = (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+    return static_cast<std::time_t>((ticks - 116444736000000000ULL) / 10000000ULL);
+}
+
+class Win32FileSystem : public FileSystem {
+  public:
+    bool get_current_dir(std::string &out) override {
+        ++counters.cwd_queries;
+        wchar_t buf[MAX_PATH];
+        DWORD len = GetCurrentDirectoryW(MAX_PATH, buf);
+        if (len == 0)
+            return false;
+        if (len < MAX_PATH) {
+            out = narrow(std::wstring_view(buf, len));
+            return true;
+        }
+        std::wstring big(len, L'\0');
+        len = GetCurrentDirectoryW(len, big.data());
+        big.resize(len);
+        out = narrow(big);
+        return len != 0;
+    }
+
+    bool set_current_dir(const std::string &path) override {
+        ++counters.cwd_changes;
+        return SetCurrentDirectoryW(widen(path).c_str()) != 0;
+    }
+
+    bool stat(const std::string &path, FileEntry &out) override {
+        ++counters.stats;
+        WIN32_FILE_ATTRIBUTE_DATA data{};
+        if (!GetFileAttributesExW(widen(path).c_str(), GetFileExInfoStandard, &data))
+            return false;
+        size_t slash = path.find_last_of('\\');
+        out.name = slash == std::string::npos ? path : path.substr(slash + 1);
+        out.is_dir = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        out.hidden = (data.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) != 0;
+        out.size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+        out.mtime = filetime_to_time_t(data.ftLastWriteTime);
+        return true;
+    }
+
+    bool list_dir(const std::string &path,
+                  const std::function<void(const FileEntry &)> &fn) override {
+        ++counters.listings;
+        std::wstring pattern = widen(path);
+        if (!pattern.empty() && pattern.back() != L'\\')
+            pattern += L'\\';
+        pattern += L'*';
+        // Basic info skips the 8.3 name lookup and the large fetch batches the directory reads,
+        // which matters on directories with many entries.
+        WIN32_FIND_DATAW fd;
+        HANDLE h = FindFirstFileExW(pattern.c_str(), FindExInfoBasic, &fd, FindExSearchNameMatch,
+                                    nullptr, FIND_FIRST_EX_LARGE_FETCH);
+        if (h == INVALID_HANDLE_VALUE)
+            return false;
+        FileEntry e;
+        do {
+            if (fd.cFileName[0] == L'.' &&
+                (fd.cFileName[1] == L'\0' || (fd.cFileName[1] == L'.' && fd.cFileName[2] == L'\0')))
+                continue;
+            ++counters.entries_listed;
+            e.name = narrow(fd.cFileName);
+            e.is_dir = (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+            e.hidden = (fd.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) != 0;
+            e.is_link = (fd.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
+            e.size = (static_cast<uint64_t>(fd.nFileSizeHigh) << 32) | fd.nFileSizeLow;
+            e.mtime = filetime_to_time_t(fd.ftLastWriteTime);
+            fn(e);
+        } while (FindNextFileW(h, &fd));
+        FindClose(h);
+        return true;
+    }
+
+    bool volume_info(char drive, VolumeInfo &out) override {
+        ++counters.volume_queries;
+        wchar_t root[] = {static_cast<wchar_t>(drive), L':', L'\\', L'\0'};
+        wchar_t label[MAX_PATH]{0};
+        DWORD serial = 0;
+        if (!GetVolumeInformationW(root, label, MAX_PATH, &serial, nullptr, nullptr, nullptr, 0))
+            return false;
+        out.label = narrow(label);
+        out.serial = serial;
+        return true;
+    }
+};
+
+std::unique_ptr<FileSystem> make_native_file_system() {
+    return std::make_unique<Win32FileSystem>();
+}
+
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool to_posix(const std::string &path, std::string &out) {
+    if (path.size() < 3 || std::toupper(static_cast<unsigned char>(path[0])) != 'C' ||
+        path[1] != ':' || path[2] != '\\')
+        return false;
+    out = path.substr(2);
+    for (char &c : out)
+        if (c == '\\')
+            c = '/';
+    return true;
+}
+
+class PosixFileSystem : public FileSystem {
+  public:
+    bool get_current_dir(std::string &out) override {
+        ++counters.cwd_queries;
+        char buf[4096];
+        if (!getcwd(buf, sizeof(buf)))
+            return false;
+        out = "C:";
+        out += buf;
+        for (char &c : out)
+            if (c == '/')
+                c = '\\';
+        return true;
+    }
+
+    bool set_current_dir(const std::string &path) override {
+        ++counters.cwd_changes;
+        std::string p;
+        return to_posix(path, p) && chdir(p.c_str()) == 0;
+    }
+
+    bool stat(const std::string &path, FileEntry &out) override {
+        ++counters.stats;
+        std::string p;
+        struct stat st;
+        if (!to_posix(path, p) || ::stat(p.c_str(), &st) != 0)
+            return false;
+        size_t slash = path.find_last_of('\\');
+        out.name = slash == std::string::npos ? path : path.substr(slash + 1);
+        out.is_dir = S_ISDIR(st.st_mode);
+        out.hidden = !out.name.empty() && out.name[0] == '.';
+        out.size = static_cast<uint64_t>(st.st_size);
+        out.mtime = st.st_mtime;
+        return true;
+    }
+
+    bool list_dir(const std::string &path,
+                  const std::function<void(const FileEntry &)> &fn) override {
+        ++counters.listings;
+        std::string p;
+        if (!to_posix(path, p))
+            return false;
+        DIR *d = opendir(p.c_str());
+        if (!d)
+            return false;
+        if (p.back() != '/')
+            p += '/';
+        FileEntry e;
+        while (dirent *de = readdir(d)) {
+            if (std::strcmp(de->d_name, ".") == 0 || std::strcmp(de->d_name, "..") == 0)
+                continue;
+            ++counters.entries_listed;
+            // Links are described by their targets; one whose target is gone is left out.
+            std::string full = p + de->d_name;
+            struct stat st;
+            if (::lstat(full.c_str(), &st) != 0)
+                continue;
+            e.is_link = S_ISLNK(st.st_mode);
+            if (e.is_link && ::stat(full.c_str(), &st) != 0)
+                continue;
+            e.name = de->d_name;
+            e.is_dir = S_ISDIR(st.st_mode);
+            e.hidden = de->d_name[0] == '.';
+            e.size = static_cast<uint64_t>(st.st_size);
+            e.mtime = st.st_mtime;
+            fn(e);
+        }
+        closedir(d);
+        return true;
+    }
+
+    bool volume_info(char drive, VolumeInfo &out) override {
+        ++counters.volume_queries;
+        if (std::toupper(static_cast<unsigned char>(drive)) != 'C')
+            return false;
+        out.label.clear();
+        out.serial = 0;
+        return true;
+    }
+};
+
+std::unique_ptr<FileSystem> make_native_file_system() {
+    return std::make_unique<PosixFileSystem>();
+}
+#endif
+
+static std::unique_ptr<FileSystem> active_file_system;
+static std::once_flag active_file_system_once;
+
+FileSystem &file_system() {
+    std::call_once(active_file_system_once, [] {
+        if (active_file_system)
+            return;
+        const char *choice = std::getenv("OPENCMD_FS");
+        if (choice && std::strcmp(choice, "memory") == 0) {
+            auto mem = std::make_unique<MemoryFileSystem>();
+            mem->add_drive('C', "OPENCMD", 0x0C3D0000);
+            mem->set_current_dir("C:\\");
+            active_file_system = std::move(mem);
+        } else if (choice && std::strcmp(choice, "uncached") == 0) {
+            active_file_system = make_native_file_system();
+        } else {
+            active_file_system = std::make_unique<CachedFileSystem>(make_native_file_system());
+        }
+    });
+    return *active_file_system;
+}
+
+void set_file_system(std::unique_ptr<FileSystem> fs) {
+    std::call_once(active_file_system_once, [] {});
+    active_file_system = std::move(fs);
+}
+
+bool wildcard_match(const char *pattern, const char *name) {
+    const char *star = nullptr;
+    const char *resume = nullptr;
+    while (*name) {
+        if (*pattern == '*') {
+            star = pattern++;
+            resume = name;
+            continue;
+        }
+        if (*pattern == '?' || std::toupper(static_cast<unsigned char>(*pattern)) ==
+                                   std::toupper(static_cast<unsigned char>(*name))) {
+            ++pattern;
+            ++name;
+            continue;
+        }
+        if (!star)
+            return false;
+        pattern = star + 1;
+        name = ++resume;
+    }
+    while (*pattern == '*')
+        ++pattern;
+    return *pattern == '\0';
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// The builtins that touch the file system (CD, DIR, FOR sets, path canonicalization, volume info)
+// go through this interface instead of calling Win32 or std::filesystem directly. Paths are UTF-8
+// in Windows form, absolute and already normalized by canonicalize(), e.g. "C:\\Users\\me".
+//
+// Three backends exist: the native one (Win32, or POSIX where drive C: maps to "/"), and an
+// in-memory one used to reproduce large directory trees and drive-letter behaviour without
+// touching a disk. A caching layer can sit in front of either.
+
+struct FileEntry {
+    std::string name;
+    bool is_dir = false;
+    bool hidden = false;
+    // A symbolic link or junction. is_dir says what it points to; tree walks do not descend
+    // through links to directories, which can lead back up the tree.
+    bool is_link = false;
+    uint64_t size = 0;
+    std::time_t mtime = 0;
+};
+
+struct VolumeInfo {
+    std::string label;
+    uint32_t serial = 0;
+};
+
+// Every backend counts the operations it performs so that the cost of a builtin can be measured
+// in calls rather than only in time.
+struct FileSystemStats {
+    std::atomic<uint64_t> cwd_queries{0};
+    std::atomic<uint64_t> cwd_changes{0};
+    std::atomic<uint64_t> stats{0};
+    std::atomic<uint64_t> listings{0};
+    std::atomic<uint64_t> entries_listed{0};
+    std::atomic<uint64_t> volume_queries{0};
+    // Listings and stats answered from memory by CachedFileSystem.
+    std::atomic<uint64_t> cache_hits{0};
+
+    void reset() {
+        cwd_queries = cwd_changes = stats = listings = entries_listed = volume_queries = 0;
+        cache_hits = 0;
+    }
+};
+
+class FileSystem {
+  protected:
+    FileSystemStats counters;
+
+  public:
+    virtual ~FileSystem() = default;
+
+    virtual bool get_current_dir(std::string &out) = 0;
+    virtual bool set_current_dir(const std::string &path) = 0;
+    virtual bool stat(const std::string &path, FileEntry &out) = 0;
+    // Calls fn for every entry of the directory except "." and "..". Returns false if the path
+    // does not name a directory.
+    virtual bool list_dir(const std::string &path,
+                          const std::function<void(const FileEntry &)> &fn) = 0;
+    // list_dir for walks that visit each directory of a tree once. A backend that keeps listings
+    // may answer from one it already has, but does not start keeping this one.
+    virtual bool scan_dir(const std::string &path,
+                          const std::function<void(const FileEntry &)> &fn) {
+        return list_dir(path, fn);
+    }
+    virtual bool volume_info(char drive, VolumeInfo &out) = 0;
+
+    bool is_directory(const std::string &path) {
+        FileEntry e;
+        return stat(path, e) && e.is_dir;
+    }
+
+    FileSystemStats &stats() { return counters; }
+};
+
+std::unique_ptr<FileSystem> make_native_file_system();
+
+// An in-memory tree with drive letters, volume labels and serial numbers. Names compare
+// case-insensitively and listings come back in name order, like NTFS. An artificial latency can
+// be charged per operation and per listed entry to model slow or remote volumes. list_dir holds
+// the tree lock while it calls back, so the callback must not call into the same backend.
+class MemoryFileSystem : public FileSystem {
+  private:
+    struct NameLess {
+        bool operator()(const std::string &a, const std::string &b) const;
+    };
+
+    struct Node {
+        FileEntry entry;
+        std::map<std::string, std::unique_ptr<Node>, NameLess> children;
+    };
+
+    struct Volume {
+        VolumeInfo info;
+        Node root;
+    };
+
+    std::mutex lock;
+    std::map<char, Volume> volumes;
+    std::string cwd;
+    std::chrono::nanoseconds op_latency{0};
+    std::chrono::nanoseconds entry_latency{0};
+
+    Node *find(const std::string &path);
+    Node *create(const std::string &path, bool is_dir);
+    void delay(std::chrono::nanoseconds d) const;
+
+  public:
+    void add_drive(char drive, const std::string &label, uint32_t serial);
+    bool make_dir(const std::string &path, std::time_t mtime = 0);
+    bool add_file(const std::string &path, uint64_t size, std::time_t mtime = 0,
+                  bool hidden = false);
+    void set_latency(std::chrono::nanoseconds per_op, std::chrono::nanoseconds per_entry = {});
+
+    bool get_current_dir(std::string &out) override;
+    bool set_current_dir(const std::string &path) override;
+    bool stat(const std::string &path, FileEntry &out) override;
+    bool list_dir(const std::string &path,
+                  const std::function<void(const FileEntry &)> &fn) override;
+    bool volume_info(char drive, VolumeInfo &out) override;
+};
+
+class DirectoryWatcher;
+
+// Keeps the listings of recently listed directories in memory in front of another backend. Each
+// cached directory is watched (ReadDirectoryChangesW, or inotify on Linux) and its listing is
+// dropped when anything in it changes. Changes are picked up by a background thread and, before a
+// cached answer is given, by draining the notifications already queued, so a listing is only as
+// stale as the change notifications. stat() of a file is answered from its directory's listing
+// when that is cached; directories themselves are stat'ed through, since the times a parent's
+// listing holds for them may lag behind. At most max_dirs directories are watched, and the least
+// recently listed is dropped first. Directories that cannot be watched are not cached, and
+// neither are those only scanned by scan_dir, so a tree walk neither watches every directory it
+// passes nor pushes the ones listed again and again out of the cache.
+class CachedFileSystem : public FileSystem {
+  private:
+    struct Listing;
+    struct Dir;
+
+    std::unique_ptr<FileSystem> inner;
+    size_t max_dirs;
+    std::mutex lock;
+    std::list<std::string> recent;
+    std::unordered_map<std::string, std::unique_ptr<Dir>> dirs;
+    std::multimap<uint64_t, std::string> watched;
+    // Last, so that its thread is stopped before the rest is torn down.
+    std::unique_ptr<DirectoryWatcher> watcher;
+
+    Dir *find_dir(const std::string &key);
+    Dir *add_dir(const std::string &key, uint64_t watch, uint64_t &spare);
+    void forget(const std::string &key);
+    void changed(uint64_t watch, bool lost);
+
+  public:
+    explicit CachedFileSystem(std::unique_ptr<FileSystem> backend, size_t max_dirs = 64);
+    ~CachedFileSystem() override;
+
+    bool get_current_dir(std::string &out) override;
+    bool set_current_dir(const std::string &path) override;
+    bool stat(const std::string &path, FileEntry &out) override;
+    bool list_dir(const std::string &path,
+                  const std::function<void(const FileEntry &)> &fn) override;
+    bool scan_dir(const std::string &path,
+                  const std::function<void(const FileEntry &)> &fn) override;
+    bool volume_info(char drive, VolumeInfo &out) override;
+};
+
+#ifndef _WIN32
+// Drive C: is the POSIX root; "C:\\usr\\bin" is "/usr/bin". Other drive letters do not exist.
+bool to_posix(const std::string &path, std::string &out);
+#endif
+
+// The backend used by the builtins. It defaults to the native one behind a CachedFileSystem;
+// setting OPENCMD_FS=memory in the environment starts the shell on an empty in-memory C: drive
+// instead, and OPENCMD_FS=uncached uses the native one directly.
+FileSystem &file_system();
+void set_file_system(std::unique_ptr<FileSystem> fs);
+
+// Matches a file name against a pattern in which * stands for any run of characters and ? for any
+// one character, ignoring case.
+bool wildcard_match(const char *pattern, const char *name);
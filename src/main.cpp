@@ -1,4 +1,6 @@
+#ifdef _WIN32
 #pragma comment(lib, "Advapi32.lib")
+#endif
 
 #include <cstdlib>
 
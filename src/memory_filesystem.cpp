@@ -0,0 +1,190 @@
+#include "filesystem.hpp"
+#include <cctype>
+#include <string>
+#include <thread>
+#include <vector>
+
+bool MemoryFileSystem::NameLess::operator()(const std::string &a, const std::string &b) const {
+    size_t n = a.size() < b.size() ? a.size() : b.size();
+    for (size_t i = 0; i < n; ++i) {
+        int ca = std::toupper(static_cast<unsigned char>(a[i]));
+        int cb = std::toupper(static_cast<unsigned char>(b[i]));
+        if (ca != cb)
+            return ca < cb;
+    }
+    return a.size() < b.size();
+}
+
+static bool split_path(const std::string &path, char &drive, std::vector<std::string> &parts) {
+    if (path.size() < 2 || !std::isalpha(static_cast<unsigned char>(path[0])) || path[1] != ':')
+        return false;
+    drive = static_cast<char>(std::toupper(static_cast<unsigned char>(path[0])));
+    parts.clear();
+    size_t i = 2;
+    while (i < path.size()) {
+        while (i < path.size() && (path[i] == '\\' || path[i] == '/'))
+            ++i;
+        size_t start = i;
+        while (i < path.size() && path[i] != '\\' && path[i] != '/')
+            ++i;
+        if (i > start)
+            parts.push_back(path.substr(start, i - start));
+    }
+    return true;
+}
+
+void MemoryFileSystem::delay(std::chrono::nanoseconds d) const {
+    if (d.count() > 0)
+        std::this_thread::sleep_for(d);
+}
+
+MemoryFileSystem::Node *MemoryFileSystem::find(const std::string &path) {
+    char drive;
+    std::vector<std::string> parts;
+    if (!split_path(path, drive, parts))
+        return nullptr;
+    auto vol = volumes.find(drive);
+    if (vol == volumes.end())
+        return nullptr;
+    Node *node = &vol->second.root;
+    for (const auto &part : parts) {
+        auto it = node->children.find(part);
+        if (it == node->children.end())
+            return nullptr;
+        node = it->second.get();
+    }
+    return node;
+}
+
+MemoryFileSystem::Node *MemoryFileSystem::create(const std::string &path, bool is_dir) {
+    char drive;
+    std::vector<std::string> parts;
+    if (!split_path(path, drive, parts) || parts.empty())
+        return nullptr;
+    auto vol = volumes.find(drive);
+    if (vol == volumes.end())
+        return nullptr;
+    Node *node = &vol->second.root;
+    for (size_t i = 0; i < parts.size(); ++i) {
+        bool last = i + 1 == parts.size();
+        auto it = node->children.find(parts[i]);
+        if (it == node->children.end()) {
+            auto child = std::make_unique<Node>();
+            child->entry.name = parts[i];
+            child->entry.is_dir = !last || is_dir;
+            it = node->children.emplace(parts[i], std::move(child)).first;
+        }
+        node = it->second.get();
+        if (!last && !node->entry.is_dir)
+            return nullptr;
+    }
+    return node->entry.is_dir == is_dir ? node : nullptr;
+}
+
+void MemoryFileSystem::add_drive(char drive, const std::string &label, uint32_t serial) {
+    std::lock_guard<std::mutex> guard(lock);
+    char letter = static_cast<char>(std::toupper(static_cast<unsigned char>(drive)));
+    Volume &vol = volumes[letter];
+    vol.info.label = label;
+    vol.info.serial = serial;
+    vol.root.entry.name = std::string(1, letter) + ":\\";
+    vol.root.entry.is_dir = true;
+}
+
+bool MemoryFileSystem::make_dir(const std::string &path, std::time_t mtime) {
+    std::lock_guard<std::mutex> guard(lock);
+    Node *node = create(path, true);
+    if (!node)
+        return false;
+    node->entry.mtime = mtime;
+    return true;
+}
+
+bool MemoryFileSystem::add_file(const std::string &path, uint64_t size, std::time_t mtime,
+                                bool hidden) {
+    std::lock_guard<std::mutex> guard(lock);
+    Node *node = create(path, false);
+    if (!node)
+        return false;
+    node->entry.size = size;
+    node->entry.mtime = mtime;
+    node->entry.hidden = hidden;
+    return true;
+}
+
+void MemoryFileSystem::set_latency(std::chrono::nanoseconds per_op,
+                                   std::chrono::nanoseconds per_entry) {
+    op_latency = per_op;
+    entry_latency = per_entry;
+}
+
+bool MemoryFileSystem::get_current_dir(std::string &out) {
+    ++counters.cwd_queries;
+    delay(op_latency);
+    std::lock_guard<std::mutex> guard(lock);
+    if (cwd.empty())
+        return false;
+    out = cwd;
+    return true;
+}
+
+bool MemoryFileSystem::set_current_dir(const std::string &path) {
+    ++counters.cwd_changes;
+    delay(op_latency);
+    std::lock_guard<std::mutex> guard(lock);
+    Node *node = find(path);
+    if (!node || !node->entry.is_dir)
+        return false;
+    char drive;
+    std::vector<std::string> parts;
+    split_path(path, drive, parts);
+    // Store the path with the case the names were created with, as Windows does.
+    cwd = std::string(1, drive) + ":";
+    Node *walk = &volumes[drive].root;
+    for (const auto &part : parts) {
+        walk = walk->children.find(part)->second.get();
+        cwd += '\\';
+        cwd += walk->entry.name;
+    }
+    if (parts.empty())
+        cwd += '\\';
+    return true;
+}
+
+bool MemoryFileSystem::stat(const std::string &path, FileEntry &out) {
+    ++counters.stats;
+    delay(op_latency);
+    std::lock_guard<std::mutex> guard(lock);
+    Node *node = find(path);
+    if (!node)
+        return false;
+    out = node->entry;
+    return true;
+}
+
+bool MemoryFileSystem::list_dir(const std::string &path,
+                                const std::function<void(const FileEntry &)> &fn) {
+    ++counters.listings;
+    delay(op_latency);
+    std::lock_guard<std::mutex> guard(lock);
+    Node *node = find(path);
+    if (!node || !node->entry.is_dir)
+        return false;
+    for (const auto &[name, child] : node->children) {
+        ++counters.entries_listed;
+        delay(entry_latency);
+        fn(child->entry);
+    }
+    return true;
+}
+
+bool MemoryFileSystem::volume_info(char drive, VolumeInfo &out) {
+    ++counters.volume_queries;
+    delay(op_latency);
+    std::lock_guard<std::mutex> guard(lock);
+    auto vol = volumes.find(static_cast<char>(std::toupper(static_cast<unsigned char>(drive))));
+    if (vol == volumes.end())
+        return false;
+    out = vol->second.info;
+    return true;
+}
@@ -0,0 +1,226 @@
+#include "native_io.hpp"
+#include "filesystem.hpp"
+#include <algorithm>
+
+#ifdef _WIN32
+#include "utf.hpp"
+
+NativeHandle std_handle(int n) {
+    return GetStdHandle(n == 0 ? STD_INPUT_HANDLE : n == 1 ? STD_OUTPUT_HANDLE : STD_ERROR_HANDLE);
+}
+
+NativeHandle open_for_reading(const std::string &path) {
+    HANDLE h = CreateFileW(widen(path).c_str(), GENERIC_READ,
+                           FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                           OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    return h == INVALID_HANDLE_VALUE ? no_handle : h;
+}
+
+NativeHandle open_for_writing(const std::string &path, bool append, bool &denied) {
+    HANDLE h = CreateFileW(widen(path).c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                           nullptr, append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL,
+                           nullptr);
+    if (h == INVALID_HANDLE_VALUE) {
+        denied = GetLastError() == ERROR_ACCESS_DENIED;
+        return no_handle;
+    }
+    denied = false;
+    if (append) {
+        LARGE_INTEGER zero{};
+        SetFilePointerEx(h, zero, nullptr, FILE_END);
+    }
+    return h;
+}
+
+NativeHandle create_temp_file(const std::string &dir) {
+    wchar_t temp[MAX_PATH + 1];
+    std::wstring folder = widen(dir);
+    if (folder.empty())
+        folder = GetTempPathW(MAX_PATH + 1, temp) ? temp : L".";
+    wchar_t name[MAX_PATH + 1];
+    if (!GetTempFileNameW(folder.c_str(), L"srt", 0, name))
+        return no_handle;
+    HANDLE h = CreateFileW(name, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                           FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+    if (h == INVALID_HANDLE_VALUE) {
+        DeleteFileW(name);
+        return no_handle;
+    }
+    return h;
+}
+
+bool create_pipe(NativeHandle &read_end, NativeHandle &write_end) {
+    return CreatePipe(&read_end, &write_end, nullptr, 0) != 0;
+}
+
+void close_handle(NativeHandle h) { CloseHandle(h); }
+
+bool read_handle(NativeHandle h, void *buf, size_t n, size_t &got) {
+    DWORD done = 0;
+    BOOL ok = ReadFile(h, buf, static_cast<DWORD>(std::min<size_t>(n, 1u << 30)), &done, nullptr);
+    got = done;
+    return ok != 0;
+}
+
+bool write_handle(NativeHandle h, const void *data, size_t n) {
+    const char *p = static_cast<const char *>(data);
+    while (n > 0) {
+        DWORD written = 0;
+        if (!WriteFile(h, p, static_cast<DWORD>(std::min<size_t>(n, 1u << 30)), &written,
+                       nullptr))
+            return false;
+        p += written;
+        n -= written;
+    }
+    return true;
+}
+
+bool rewind_handle(NativeHandle h) {
+    LARGE_INTEGER zero{};
+    return SetFilePointerEx(h, zero, nullptr, FILE_BEGIN) != 0;
+}
+
+bool is_disk_file(NativeHandle h) { return GetFileType(h) == FILE_TYPE_DISK; }
+
+bool disk_file_size(NativeHandle h, uint64_t &size) {
+    LARGE_INTEGER li{};
+    if (!is_disk_file(h) || !GetFileSizeEx(h, &li))
+        return false;
+    size = static_cast<uint64_t>(li.QuadPart);
+    return true;
+}
+
+bool replace_file(const std::string &from, const std::string &to) {
+    return MoveFileExW(widen(from).c_str(), widen(to).c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
+void delete_file(const std::string &path) { DeleteFileW(widen(path).c_str()); }
+
+void create_directory(const std::string &path) { CreateDirectoryW(widen(path).c_str(), nullptr); }
+
+bool is_program_file(const std::string &path) {
+    DWORD attributes = GetFileAttributesW(widen(path).c_str());
+    return attributes != INVALID_FILE_ATTRIBUTES && !(attributes & FILE_ATTRIBUTE_DIRECTORY);
+}
+
+unsigned long process_id() { return GetCurrentProcessId(); }
+
+#else
+#include <cctype>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <fcntl.h>
+#include <mutex>
+#include <sys/stat.h>
+#include <unistd.h>
+
+std::string native_path(const std::string &path) {
+    std::string out;
+    if (path.size() >= 3 && path[1] == ':' && path[2] == '\\' && to_posix(path, out))
+        return out;
+    if (path.size() == 3 && std::toupper(static_cast<unsigned char>(path[0])) == 'N' &&
+        std::toupper(static_cast<unsigned char>(path[1])) == 'U' &&
+        std::toupper(static_cast<unsigned char>(path[2])) == 'L')
+        return "/dev/null";
+    out = path;
+    std::replace(out.begin(), out.end(), '\\', '/');
+    return out;
+}
+
+NativeHandle std_handle(int n) { return n; }
+
+NativeHandle open_for_reading(const std::string &path) {
+    int fd = open(native_path(path).c_str(), O_RDONLY | O_CLOEXEC);
+    return fd < 0 ? no_handle : fd;
+}
+
+NativeHandle open_for_writing(const std::string &path, bool append, bool &denied) {
+    int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+    int fd = open(native_path(path).c_str(), flags, 0666);
+    denied = fd < 0 && (errno == EACCES || errno == EPERM);
+    return fd < 0 ? no_handle : fd;
+}
+
+NativeHandle create_temp_file(const std::string &dir) {
+    std::string folder = dir.empty() ? std::string() : native_path(dir);
+    if (folder.empty()) {
+        const char *tmp = std::getenv("TMPDIR");
+        folder = tmp && *tmp ? tmp : "/tmp";
+    }
+    std::string name = folder + "/srtXXXXXX";
+    int fd = mkostemp(name.data(), O_CLOEXEC);
+    if (fd < 0)
+        return no_handle;
+    unlink(name.c_str());
+    return fd;
+}
+
+bool create_pipe(NativeHandle &read_end, NativeHandle &write_end) {
+    // A write to a pipe whose reader has gone must fail rather than end the shell.
+    static std::once_flag ignore_sigpipe;
+    std::call_once(ignore_sigpipe, [] { std::signal(SIGPIPE, SIG_IGN); });
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0)
+        return false;
+    read_end = fds[0];
+    write_end = fds[1];
+    return true;
+}
+
+void close_handle(NativeHandle h) { close(h); }
+
+bool read_handle(NativeHandle h, void *buf, size_t n, size_t &got) {
+    ssize_t r;
+    do {
+        r = read(h, buf, n);
+    } while (r < 0 && errno == EINTR);
+    got = r > 0 ? static_cast<size_t>(r) : 0;
+    return r >= 0;
+}
+
+bool write_handle(NativeHandle h, const void *data, size_t n) {
+    const char *p = static_cast<const char *>(data);
+    while (n > 0) {
+        ssize_t r = write(h, p, n);
+        if (r < 0 && errno == EINTR)
+            continue;
+        if (r <= 0)
+            return false;
+        p += r;
+        n -= static_cast<size_t>(r);
+    }
+    return true;
+}
+
+bool rewind_handle(NativeHandle h) { return lseek(h, 0, SEEK_SET) == 0; }
+
+bool is_disk_file(NativeHandle h) {
+    struct stat st;
+    return fstat(h, &st) == 0 && S_ISREG(st.st_mode);
+}
+
+bool disk_file_size(NativeHandle h, uint64_t &size) {
+    struct stat st;
+    if (fstat(h, &st) != 0 || !S_ISREG(st.st_mode))
+        return false;
+    size = static_cast<uint64_t>(st.st_size);
+    return true;
+}
+
+bool replace_file(const std::string &from, const std::string &to) {
+    return rename(native_path(from).c_str(), native_path(to).c_str()) == 0;
+}
+
+void delete_file(const std::string &path) { unlink(native_path(path).c_str()); }
+
+void create_directory(const std::string &path) { mkdir(native_path(path).c_str(), 0777); }
+
+bool is_program_file(const std::string &path) {
+    std::string p = native_path(path);
+    struct stat st;
+    return ::stat(p.c_str(), &st) == 0 && S_ISREG(st.st_mode) && access(p.c_str(), X_OK) == 0;
+}
+
+unsigned long process_id() { return static_cast<unsigned long>(getpid()); }
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// The handles of open files, pipes and the standard streams, and the few operations on them the
+// shell needs outside the FileSystem interface: redirections, pipes, SORT's input and temporary
+// files, and WHERE's index. A HANDLE on Windows and a file descriptor elsewhere. Handles opened
+// here are never inherited by child processes unless they are handed to one explicitly.
+//
+// Paths are the shell's UTF-8 paths. On POSIX systems a path on drive C: maps to the root, as in
+// the FileSystem backend, "NUL" is /dev/null and any other path is taken relative to the current
+// directory with its separators turned around.
+#ifdef _WIN32
+using NativeHandle = HANDLE;
+constexpr NativeHandle no_handle = nullptr;
+#else
+using NativeHandle = int;
+constexpr NativeHandle no_handle = -1;
+#endif
+
+// 0, 1 or 2 for standard input, output or error.
+NativeHandle std_handle(int n);
+
+// Return no_handle on failure.
+NativeHandle open_for_reading(const std::string &path);
+// Truncates the file unless append is set, in which case every write goes to its end. denied is
+// set when the failure was a lack of permission.
+NativeHandle open_for_writing(const std::string &path, bool append, bool &denied);
+// A file in dir, or in the system temporary directory when dir is empty, that disappears when it
+// is closed.
+NativeHandle create_temp_file(const std::string &dir);
+
+bool create_pipe(NativeHandle &read_end, NativeHandle &write_end);
+void close_handle(NativeHandle h);
+
+// Reads up to n bytes; got is 0 at the end of the input. Returns false on errors, which for a
+// pipe include the writer having closed it.
+bool read_handle(NativeHandle h, void *buf, size_t n, size_t &got);
+// Writes all n bytes or returns false.
+bool write_handle(NativeHandle h, const void *data, size_t n);
+bool rewind_handle(NativeHandle h);
+
+// Whether h is a regular file on disk, as opposed to a pipe or a console, and its size if so.
+bool is_disk_file(NativeHandle h);
+bool disk_file_size(NativeHandle h, uint64_t &size);
+
+// Replaces to with from in one step.
+bool replace_file(const std::string &from, const std::string &to);
+void delete_file(const std::string &path);
+// Creates the last component of path if it does not exist.
+void create_directory(const std::string &path);
+// Whether path is a file that can be run as a program.
+bool is_program_file(const std::string &path);
+unsigned long process_id();
+
+#ifndef _WIN32
+// The POSIX form of a shell path, as described above.
+std::string native_path(const std::string &path);
+#endif
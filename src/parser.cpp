@@ -0,0 +1,259 @@
+#include "parser.hpp"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+namespace cmd {
+
+static const char *const syntax_error = "The syntax of the command is incorrect.";
+
+static bool iequals(const std::string &a, const char *b) {
+    size_t n = std::strlen(b);
+    if (a.size() != n)
+        return false;
+    for (size_t i = 0; i < n; ++i)
+        if (std::tolower(static_cast<unsigned char>(a[i])) != b[i])
+            return false;
+    return true;
+}
+
+static std::unique_ptr<Node> join(NodeKind kind, std::unique_ptr<Node> left,
+                                  std::unique_ptr<Node> right) {
+    auto n = std::make_unique<Node>(kind);
+    n->left = std::move(left);
+    n->right = std::move(right);
+    return n;
+}
+
+const Token *Parser::peek() const { return pos < toks.size() ? &toks[pos] : nullptr; }
+
+bool Parser::at_symbol(const char *text) const {
+    const Token *t = peek();
+    return t && t->kind == TokenKind::Symbol && t->text == text;
+}
+
+bool Parser::at_redirection() const {
+    const Token *t = peek();
+    if (!t || t->kind != TokenKind::Symbol)
+        return false;
+    char c = t->text[0];
+    return c == '<' || c == '>' || std::isdigit(static_cast<unsigned char>(c));
+}
+
+bool Parser::fail(const std::string &message) {
+    if (err.empty())
+        err = message;
+    return false;
+}
+
+std::unique_ptr<Node> Parser::parse() {
+    std::unique_ptr<Node> root = parse_sequence(false);
+    if (!err.empty())
+        return nullptr;
+    if (const Token *t = peek()) {
+        fail(t->text + " was unexpected at this time.");
+        return nullptr;
+    }
+    return root;
+}
+
+// Commands joined by & or, unless stop_at_newline is set, by line breaks. Blank lines and a
+// trailing & are empty statements.
+std::unique_ptr<Node> Parser::parse_sequence(bool stop_at_newline) {
+    std::unique_ptr<Node> seq;
+    while (true) {
+        while (!stop_at_newline && at_symbol("\n"))
+            ++pos;
+        if (!peek() || at_symbol(")") || at_symbol("\n"))
+            break;
+        std::unique_ptr<Node> next = parse_condition();
+        if (!next)
+            return nullptr;
+        seq = seq ? join(NodeKind::Sequence, std::move(seq), std::move(next)) : std::move(next);
+        if (at_symbol("&"))
+            ++pos;
+        else if (stop_at_newline || !at_symbol("\n"))
+            break;
+    }
+    return seq;
+}
+
+std::unique_ptr<Node> Parser::parse_condition() {
+    std::unique_ptr<Node> left = parse_pipeline();
+    while (left && (at_symbol("&&") || at_symbol("||"))) {
+        NodeKind kind = toks[pos++].text == "&&" ? NodeKind::And : NodeKind::Or;
+        std::unique_ptr<Node> right = parse_pipeline();
+        if (!right)
+            return nullptr;
+        left = join(kind, std::move(left), std::move(right));
+    }
+    return left;
+}
+
+std::unique_ptr<Node> Parser::parse_pipeline() {
+    std::unique_ptr<Node> left = parse_redirected();
+    while (left && at_symbol("|")) {
+        ++pos;
+        std::unique_ptr<Node> right = parse_redirected();
+        if (!right)
+            return nullptr;
+        left = join(NodeKind::Pipe, std::move(left), std::move(right));
+    }
+    return left;
+}
+
+// A command, block or FOR loop together with the redirections written before or after it.
+std::unique_ptr<Node> Parser::parse_redirected() {
+    std::vector<Redirection> redirections;
+    while (at_redirection())
+        if (!parse_redirection(redirections))
+            return nullptr;
+
+    const Token *t = peek();
+    std::unique_ptr<Node> node;
+    if (!t) {
+        fail(syntax_error);
+        return nullptr;
+    }
+    if (at_symbol("(")) {
+        ++pos;
+        node = std::make_unique<Node>(NodeKind::Block);
+        node->left = parse_sequence(false);
+        if (!err.empty())
+            return nullptr;
+        if (!at_symbol(")")) {
+            fail(syntax_error);
+            return nullptr;
+        }
+        ++pos;
+    } else if (t->kind == TokenKind::Symbol) {
+        fail(t->text + " was unexpected at this time.");
+        return nullptr;
+    } else if (t->kind == TokenKind::Identifier && iequals(t->text, "for")) {
+        ++pos;
+        node = parse_for();
+        if (!node)
+            return nullptr;
+    } else {
+        node = std::make_unique<Node>(NodeKind::Command);
+        node->command.name = t->text;
+        ++pos;
+        while ((t = peek())) {
+            if (at_redirection()) {
+                if (!parse_redirection(redirections))
+                    return nullptr;
+                continue;
+            }
+            if (t->kind == TokenKind::Symbol)
+                break;
+            node->command.args.push_back(
+                {t->kind == TokenKind::Flag, t->text, t->kind == TokenKind::String});
+            ++pos;
+        }
+    }
+
+    while (at_redirection())
+        if (!parse_redirection(redirections))
+            return nullptr;
+    if (redirections.empty())
+        return node;
+    auto wrapped = std::make_unique<Node>(NodeKind::Redirect);
+    wrapped->redirections = std::move(redirections);
+    wrapped->left = std::move(node);
+    return wrapped;
+}
+
+bool Parser::parse_redirection(std::vector<Redirection> &out) {
+    const std::string &text = toks[pos++].text;
+    size_t i = 0;
+    Redirection r;
+    if (std::isdigit(static_cast<unsigned char>(text[0])))
+        r.handle = text[i++] - '0';
+    else
+        r.handle = text[0] == '<' ? 0 : 1;
+    r.input = text[i] == '<';
+    if (!r.input && text.compare(i, 2, ">>") == 0)
+        r.append = true;
+    i += r.append ? 2 : 1;
+    if (i + 1 < text.size() && text[i] == '&') {
+        r.dup_handle = text[i + 1] - '0';
+    } else {
+        const Token *t = peek();
+        if (!t || t->kind == TokenKind::Symbol)
+            return fail(syntax_error);
+        r.target = t->text;
+        ++pos;
+    }
+    out.push_back(std::move(r));
+    return true;
+}
+
+// FOR [/J[:n]] %v IN ( set ) DO body, with "for" already consumed.
+std::unique_ptr<Node> Parser::parse_for() {
+    auto node = std::make_unique<Node>(NodeKind::For);
+    ForLoop &loop = node->loop;
+    const Token *t;
+    while ((t = peek()) && t->kind == TokenKind::Flag) {
+        if (!iequals(t->text.substr(0, 2), "/j") || (t->text.size() > 2 && t->text[2] != ':')) {
+            fail("Invalid switch - " + t->text);
+            return nullptr;
+        }
+        loop.parallel = true;
+        if (t->text.size() > 2) {
+            int n = std::atoi(t->text.c_str() + 3);
+            if (n <= 0) {
+                fail("Invalid job count - " + t->text.substr(3));
+                return nullptr;
+            }
+            loop.jobs = static_cast<unsigned>(n);
+        }
+        ++pos;
+    }
+
+    t = peek();
+    if (!t || t->kind == TokenKind::Symbol || t->text.empty() || t->text[0] != '%') {
+        fail(syntax_error);
+        return nullptr;
+    }
+    size_t var_pos = t->text.size() == 3 && t->text[1] == '%' ? 2 : 1;
+    if (t->text.size() != var_pos + 1) {
+        fail(syntax_error);
+        return nullptr;
+    }
+    loop.var = t->text[var_pos];
+    ++pos;
+
+    if (!(t = peek()) || t->kind == TokenKind::Symbol || !iequals(t->text, "in")) {
+        fail(syntax_error);
+        return nullptr;
+    }
+    ++pos;
+    if (!at_symbol("(")) {
+        fail(syntax_error);
+        return nullptr;
+    }
+    ++pos;
+    while ((t = peek()) && t->kind != TokenKind::Symbol) {
+        loop.set.push_back({t->kind == TokenKind::Flag, t->text, t->kind == TokenKind::String});
+        ++pos;
+    }
+    if (!at_symbol(")")) {
+        fail(t ? t->text + " was unexpected at this time." : syntax_error);
+        return nullptr;
+    }
+    ++pos;
+
+    if (!(t = peek()) || t->kind == TokenKind::Symbol || !iequals(t->text, "do")) {
+        fail(syntax_error);
+        return nullptr;
+    }
+    ++pos;
+    node->left = parse_sequence(true);
+    if (!node->left) {
+        fail(syntax_error);
+        return nullptr;
+    }
+    return node;
+}
+
+} // namespace cmd
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "tokenizer.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cmd {
+
+struct Arg {
+    bool is_flag;
+    std::string text;
+    // The word contained quotes; it is quoted again when passed to a child process.
+    bool quoted = false;
+};
+
+struct CommandAST {
+    std::string name;
+    std::vector<Arg> args;
+};
+
+// n>file, n>>file, n<file or n>&m. handle is 0, 1 or 2; dup_handle is -1 unless the target is
+// another handle.
+struct Redirection {
+    int handle;
+    bool input = false;
+    bool append = false;
+    int dup_handle = -1;
+    std::string target;
+};
+
+struct ForLoop {
+    char var = 0;
+    bool parallel = false;
+    unsigned jobs = 0;
+    std::vector<Arg> set;
+};
+
+enum class NodeKind {
+    Command,  // command
+    Sequence, // left & right, or two lines of a block
+    And,      // left && right
+    Or,       // left || right
+    Pipe,     // left | right
+    Block,    // ( left ), left may be null
+    Redirect, // left with redirections applied
+    For,      // FOR loop over the set, left is the body
+};
+
+// A parsed command line. The tree is built once per line; FOR bodies and blocks are executed from
+// it directly, with loop variables substituted into the words of each Command as it runs, so
+// nothing is tokenized again while a loop iterates.
+struct Node {
+    NodeKind kind;
+    CommandAST command;
+    std::vector<Redirection> redirections;
+    ForLoop loop;
+    std::unique_ptr<Node> left;
+    std::unique_ptr<Node> right;
+
+    explicit Node(NodeKind k) : kind(k) {}
+};
+
+// Builds the tree from the tokens of one (possibly multi-line) command line. Precedence follows
+// CMD: | binds tightest, then && and || (left to right, equal precedence), then & and line breaks.
+// A FOR body extends to the end of its line or block.
+class Parser {
+  private:
+    const std::vector<Token> &toks;
+    size_t pos;
+    std::string err;
+
+    const Token *peek() const;
+    bool at_symbol(const char *text) const;
+    bool at_redirection() const;
+    bool fail(const std::string &message);
+
+    std::unique_ptr<Node> parse_sequence(bool stop_at_newline);
+    std::unique_ptr<Node> parse_condition();
+    std::unique_ptr<Node> parse_pipeline();
+    std::unique_ptr<Node> parse_redirected();
+    std::unique_ptr<Node> parse_for();
+    bool parse_redirection(std::vector<Redirection> &out);
+
+  public:
+    explicit Parser(const std::vector<Token> &t) : toks(t), pos(0) {}
+    bool empty() const { return pos >= toks.size(); }
+    // Returns null for an empty line, or on a syntax error, in which case error() says why.
+    std::unique_ptr<Node> parse();
+    const std::string &error() const { return err; }
+};
+
+} // namespace cmd
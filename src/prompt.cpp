@@ -0,0 +1,157 @@
+#include "prompt.hpp"
+#include "environment.hpp"
+#include "macros.hpp"
+#include "run_command.hpp"
+#include <chrono>
+#include <cctype>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <string>
+
+void PromptTemplate::append_literal(const std::string &text) {
+    if (!segments.empty() && segments.back().kind == SegmentKind::Literal)
+        segments.back().text += text;
+    else
+        segments.push_back({SegmentKind::Literal, text});
+}
+
+PromptTemplate::PromptTemplate(const std::string &spec) {
+    for (size_t i = 0; i < spec.size(); ++i) {
+        if (spec[i] != '$' || i + 1 >= spec.size()) {
+            append_literal(std::string(1, spec[i]));
+            continue;
+        }
+        char code = static_cast<char>(std::toupper(static_cast<unsigned char>(spec[++i])));
+        switch (code) {
+        case 'A':
+            append_literal("&");
+            break;
+        case 'B':
+            append_literal("|");
+            break;
+        case 'C':
+            append_literal("(");
+            break;
+        case 'E':
+            append_literal("\033");
+            break;
+        case 'F':
+            append_literal(")");
+            break;
+        case 'G':
+            append_literal(">");
+            break;
+        case 'H':
+            append_literal("\b");
+            break;
+        case 'L':
+            append_literal("<");
+            break;
+        case 'Q':
+            append_literal("=");
+            break;
+        case 'S':
+            append_literal(" ");
+            break;
+        case 'V':
+            append_literal("OpenCMD " VERSION);
+            break;
+        case '_':
+            // The prompt goes to std::cout, which is in text mode on Windows and turns this into
+            // carriage return and linefeed there; an explicit "\r\n" would come out as CR CR LF.
+            append_literal("\n");
+            break;
+        case '$':
+            append_literal("$");
+            break;
+        case 'P':
+            segments.push_back({SegmentKind::Path, {}});
+            uses_cwd = true;
+            break;
+        case 'N':
+            segments.push_back({SegmentKind::Drive, {}});
+            uses_cwd = true;
+            break;
+        case 'T':
+            segments.push_back({SegmentKind::Time, {}});
+            uses_clock = true;
+            break;
+        case 'D':
+            segments.push_back({SegmentKind::Date, {}});
+            uses_clock = true;
+            break;
+        default:
+            // CMD silently drops unknown codes.
+            break;
+        }
+    }
+}
+
+const std::string &PromptTemplate::render() {
+    unsigned generation = uses_cwd ? current_directory_generation() : 0;
+    if (rendered && !uses_clock && generation == rendered_generation)
+        return cache;
+
+    std::string cwd = uses_cwd ? current_directory() : std::string();
+    std::tm now{};
+    unsigned centiseconds = 0;
+    if (uses_clock) {
+        auto clock = std::chrono::system_clock::now();
+        std::time_t seconds = std::chrono::system_clock::to_time_t(clock);
+#ifdef _WIN32
+        localtime_s(&now, &seconds);
+#else
+        localtime_r(&seconds, &now);
+#endif
+        auto since_second = clock.time_since_epoch() % std::chrono::seconds(1);
+        centiseconds = static_cast<unsigned>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(since_second).count() / 10);
+    }
+
+    cache.clear();
+    for (const auto &seg : segments) {
+        switch (seg.kind) {
+        case SegmentKind::Literal:
+            cache += seg.text;
+            break;
+        case SegmentKind::Path:
+            cache += cwd;
+            break;
+        case SegmentKind::Drive:
+            if (!cwd.empty())
+                cache += cwd[0];
+            break;
+        case SegmentKind::Time: {
+            char buf[16];
+            std::snprintf(buf, sizeof(buf), "%2d:%02d:%02d.%02u", now.tm_hour, now.tm_min,
+                          now.tm_sec, centiseconds);
+            cache += buf;
+            break;
+        }
+        case SegmentKind::Date: {
+            static const char *const days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+            char buf[32];
+            std::snprintf(buf, sizeof(buf), "%s %02d/%02d/%04d", days[now.tm_wday % 7],
+                          now.tm_mon + 1, now.tm_mday, now.tm_year + 1900);
+            cache += buf;
+            break;
+        }
+        }
+    }
+    rendered = true;
+    rendered_generation = generation;
+    return cache;
+}
+
+static std::unique_ptr<PromptTemplate> active_prompt;
+
+void set_prompt(const std::string &spec) { active_prompt = std::make_unique<PromptTemplate>(spec); }
+
+const std::string &render_prompt() {
+    if (!active_prompt) {
+        std::string spec;
+        set_prompt(get_env_var("PROMPT", spec) ? spec : std::string(default_prompt));
+    }
+    return active_prompt->render();
+}
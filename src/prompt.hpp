@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+inline constexpr const char *default_prompt = "$P$G";
+
+// A PROMPT string compiled once into runs of literal text and the codes whose value can change
+// between redraws. The rendered prompt is kept and reused until the current directory changes, so
+// a redraw with an unchanged directory makes no system calls unless the prompt shows the clock.
+class PromptTemplate {
+  private:
+    enum class SegmentKind {
+        Literal,
+        Path,
+        Drive,
+        Time,
+        Date,
+    };
+
+    struct Segment {
+        SegmentKind kind;
+        std::string text;
+    };
+
+    std::vector<Segment> segments;
+    bool uses_clock = false;
+    bool uses_cwd = false;
+    bool rendered = false;
+    unsigned rendered_generation = 0;
+    std::string cache;
+
+    void append_literal(const std::string &text);
+
+  public:
+    explicit PromptTemplate(const std::string &spec);
+    const std::string &render();
+};
+
+void set_prompt(const std::string &spec);
+const std::string &render_prompt();
@@ -1,271 +1,177 @@
-#define _AMD64_
-
+#include "alloc_stats.hpp"
+#include "environment.hpp"
+#include "external_sort.hpp"
+#include "file_stream.hpp"
+#include "filesystem.hpp"
 #include "macros.hpp"
+#include "native_io.hpp"
+#include "parser.hpp"
+#include "prompt.hpp"
+#include "tokenizer.hpp"
+#include "utf.hpp"
+#include "where.hpp"
+#include "worker_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cctype>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <fileapi.h>
-#include <filesystem>
+#include <ctime>
+#include <iomanip>
 #include <iostream>
 #include <memory>
-#include <minwindef.h>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
+
+#ifdef _WIN32
 #include <windows.h>
-#include <winnt.h>
+#else
+#include <cerrno>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/utsname.h>
+#include <sys/wait.h>
+#endif
 
 extern bool echo_enabled;
 
 char *trimString(char *str);
 using command_handler_t = int (*)(int argc, char **argv);
 
-namespace cmd {
-
-enum class TokenKind {
-    Identifier,
-    String,
-    Flag,
-    End,
-    Symbol,
-};
-
-struct Token {
-    TokenKind kind;
-    std::string text;
-};
-
-class Tokenizer {
-  private:
-    const char *p;
-
-    static bool is_ws(char c) { return std::isspace(static_cast<unsigned char>(c)); }
-
-    static bool is_flag_start(char c) { return c == '/'; }
-
-    void skip_ws() {
-        while (*p && is_ws(*p))
-            ++p;
-    }
-
-    std::string parse_quoted(char quote) {
-        std::string out;
-        ++p;
-        while (*p) {
-            if (*p == quote) {
-                ++p;
-                break;
-            }
-            if (*p == '\\' && (*(p + 1) == quote || *(p + 1) == '\\')) {
-                ++p;
-            }
-            out.push_back(*p);
-            ++p;
-        }
-        return out;
-    }
-
-  public:
-    explicit Tokenizer(const char *s) : p(s ? s : "") {}
-
-    Token next() {
-        skip_ws();
-        if (!*p)
-            return {TokenKind::End, ""};
-
-        if (*p == '"' || *p == '\'') {
-            char q = *p;
-            std::string s = parse_quoted(q);
-            return {TokenKind::String, s};
-        }
-
-        if (is_flag_start(*p)) {
-            const char *start = p++;
-            while (*p && !is_ws(*p))
-                ++p;
-            return {TokenKind::Flag, std::string(start, static_cast<size_t>(p - start))};
-        }
-
-        const char *start = p;
-        while (*p && !is_ws(*p))
-            ++p;
-
-        std::string text(start, static_cast<size_t>(p - start));
-
-        if (!text.empty() && text[0] != '/' && text.find('/') != std::string::npos) {
-            size_t pos = text.find('/');
-            std::string before = text.substr(0, pos);
-            p = p - (text.size() - pos);
-            if (!before.empty())
-                return {TokenKind::Identifier, before};
-        }
-
-        if (text == "echo." || text == "echo") {
-            return {TokenKind::Identifier, text};
-        }
-
-        if (text.rfind("echo.", 0) == 0 && text.size() > 5) {
-            p = start + 4;
-            return {TokenKind::Identifier, "echo"};
-        }
-
-        return {TokenKind::Identifier, text};
+// Collapses "." and ".." components and repeated separators of an absolute path whose root is
+// "X:\" or "\\server\share". ".." never climbs above the root.
+static std::string normalize_path(const std::string &p) {
+    size_t root_len;
+    if (p.size() >= 2 && p[0] == '\\' && p[1] == '\\') {
+        size_t server_end = p.find('\\', 2);
+        size_t share_end =
+            server_end == std::string::npos ? std::string::npos : p.find('\\', server_end + 1);
+        if (share_end == std::string::npos)
+            return p;
+        root_len = share_end + 1;
+    } else if (p.size() >= 3 && p[1] == ':' && p[2] == '\\') {
+        root_len = 3;
+    } else {
+        return p;
     }
-
-    std::vector<Token> tokenize() {
-        std::vector<Token> out;
-        while (true) {
-            Token t = next();
-            if (t.kind == TokenKind::End)
-                break;
-            out.push_back(std::move(t));
-            if (out.size() >= 256)
-                break;
-        }
-
-        for (size_t i = 0; i + 1 < out.size(); ++i) {
-            if (out[i].text == "echo" && out[i + 1].text.rfind(".", 0) == 0 &&
-                out[i + 1].text.size() > 1) {
-                out[i + 1].text = out[i + 1].text.substr(1);
+    std::string out = p.substr(0, root_len);
+    std::vector<size_t> starts;
+    size_t i = root_len;
+    while (i < p.size()) {
+        size_t end = p.find('\\', i);
+        if (end == std::string::npos)
+            end = p.size();
+        std::string_view part(p.data() + i, end - i);
+        i = end + 1;
+        if (part.empty() || part == ".")
+            continue;
+        if (part == "..") {
+            if (!starts.empty()) {
+                out.resize(starts.back());
+                starts.pop_back();
             }
+            continue;
         }
-
-        return out;
-    }
-};
-
-struct Arg {
-    bool is_flag;
-    std::string text;
-};
-
-struct CommandAST {
-    std::string name;
-    std::vector<Arg> args;
-};
-
-class Parser {
-  private:
-    const std::vector<Token> &toks;
-    size_t pos;
-
-  public:
-    explicit Parser(const std::vector<Token> &t) : toks(t), pos(0) {}
-    bool empty() const { return pos >= toks.size(); }
-    CommandAST parse() {
-        CommandAST cmd;
-        if (toks.empty())
-            return cmd;
-
-        cmd.name = toks[0].text;
-
-        if (cmd.name == "echo.") {
-            cmd.name = "echo";
-            Arg a;
-            a.text = ".";
-            cmd.args.push_back(a);
-            return cmd;
-        }
-
-        if (cmd.name.rfind("echo.", 0) == 0 && cmd.name.size() > 5) {
-            std::string rest = cmd.name.substr(5);
-            cmd.name = "echo";
-            Arg a;
-            a.text = rest;
-            cmd.args.push_back(a);
-            return cmd;
-        }
-
-        for (size_t i = 1; i < toks.size(); ++i) {
-            const Token &tk = toks[i];
-            Arg a;
-            a.is_flag = (tk.kind == TokenKind::Flag);
-            a.text = tk.text;
-            cmd.args.push_back(std::move(a));
-        }
-
-        return cmd;
+        starts.push_back(out.size());
+        if (out.back() != '\\')
+            out += '\\';
+        out += part;
     }
-};
+    return out;
+}
 
-} // namespace cmd
+std::string current_directory();
 
 std::string canonicalize(const std::string &path) {
-    namespace fs = std::filesystem;
     extern const char *get_drive_dir(char);
     std::string p = path;
     for (char &c : p)
         if (c == '/')
             c = '\\';
-    if (p.empty()) {
-        try {
-            return fs::absolute(fs::path(".")).lexically_normal().string();
-        } catch (...) {
-            return std::string();
-        }
-    }
-    if (p.size() >= 2 && p[0] == '\\' && p[1] == '\\') {
-        try {
-            return fs::path(p).lexically_normal().string();
-        } catch (...) {
-            return p;
-        }
-    }
+    std::string cur = current_directory();
+    if (p.empty())
+        return cur;
+    if (p.size() >= 2 && p[0] == '\\' && p[1] == '\\')
+        return normalize_path(p);
     if (p.size() >= 2 && std::isalpha(static_cast<unsigned char>(p[0])) && p[1] == ':') {
         char drive = static_cast<char>(std::toupper(static_cast<unsigned char>(p[0])));
+        p[0] = drive;
         if (p.size() == 2) {
             const char *saved = get_drive_dir(drive);
             if (saved && saved[0])
                 return std::string(saved);
             return std::string(1, drive) + ":\\";
         }
-        if (p.size() >= 3 && (p[2] == '\\')) {
-            try {
-                return fs::path(p).lexically_normal().string();
-            } catch (...) {
-                return p;
-            }
-        } else {
-            const char *saved = get_drive_dir(drive);
-            std::string base =
-                (saved && saved[0]) ? std::string(saved) : (std::string(1, drive) + ":\\");
-            std::string remainder = p.substr(2);
-            std::string combined = base;
-            if (!combined.empty() && combined.back() != '\\')
-                combined += '\\';
-            combined += remainder;
-            try {
-                return fs::path(combined).lexically_normal().string();
-            } catch (...) {
-                return combined;
-            }
-        }
+        if (p[2] == '\\')
+            return normalize_path(p);
+        const char *saved = get_drive_dir(drive);
+        std::string combined =
+            (saved && saved[0]) ? std::string(saved) : (std::string(1, drive) + ":\\");
+        if (combined.back() != '\\')
+            combined += '\\';
+        combined += p.substr(2);
+        return normalize_path(combined);
     }
-    if (p.size() >= 1 && p[0] == '\\') {
-        std::string cur;
-        try {
-            cur = fs::current_path().string();
-        } catch (...) {
-            cur = "C:\\";
-        }
+    if (p[0] == '\\') {
         char drive =
             cur.empty() ? 'C' : static_cast<char>(std::toupper(static_cast<unsigned char>(cur[0])));
-        std::string combined = std::string(1, drive) + ":" + p;
-        try {
-            return fs::path(combined).lexically_normal().string();
-        } catch (...) {
-            return combined;
-        }
+        return normalize_path(std::string(1, drive) + ":" + p);
     }
-    try {
-        fs::path ap = fs::absolute(fs::path(p));
-        return ap.lexically_normal().string();
-    } catch (...) {
+    if (cur.empty())
         return p;
-    }
+    std::string combined = cur;
+    if (combined.back() != '\\')
+        combined += '\\';
+    combined += p;
+    return normalize_path(combined);
 }
 
-void ClearScreen() { std::cout << "\033[2J\033[3J\033[H"; }
+// Where the standard streams of the running command go. Builtins write to out and err (std::cout
+// and std::cerr when null). A child process is given the handles; where a handle is unset but the
+// stream is set, as for output captured from a worker thread, the child writes into a pipe that is
+// drained into the stream. Redirections and captures install their own StdStreams for the
+// duration of a command and restore the previous one afterwards.
+struct StdStreams {
+    std::ostream *out = nullptr;
+    std::ostream *err = nullptr;
+    NativeHandle in_handle = no_handle;
+    NativeHandle out_handle = no_handle;
+    NativeHandle err_handle = no_handle;
+};
+
+static thread_local StdStreams streams;
+
+// Output of a command that runs on a worker thread is collected here instead of going straight to
+// the console, so that the caller can emit it later in a deterministic order.
+struct CapturedOutput {
+    std::ostringstream out;
+    std::ostringstream err;
+};
+
+std::ostream &cmd_out() { return streams.out ? *streams.out : std::cout; }
+
+std::ostream &cmd_err() { return streams.err ? *streams.err : std::cerr; }
+
+void ClearScreen() { cmd_out() << "\033[2J\033[3J\033[H"; }
+
+// Names where the running command is when it runs beside other commands, such as the body of a
+// FOR /J loop on a pool thread or either side of a pipe; null otherwise. Such a command shares the
+// current directory, the SETLOCAL stack, the echo state and the process with the commands around
+// it, so the builtins that change those refuse to run there rather than race with them.
+static thread_local const char *detached_context = nullptr;
+
+static bool refused_when_detached(const char *command) {
+    if (!detached_context)
+        return false;
+    cmd_err() << command << " cannot be used inside " << detached_context << ".\n";
+    return true;
+}
 
 bool is_help_flag_present(int argc, char **argv) {
     for (int i = 1; i < argc; ++i) {
@@ -290,11 +196,24 @@ bool is_flag_present(int argc, char **argv, std::string flag) {
     return false;
 }
 
+bool iequals(const std::string &a, const char *b) {
+    size_t n = std::strlen(b);
+    if (a.size() != n)
+        return false;
+    for (size_t i = 0; i < n; ++i)
+        if (std::toupper(static_cast<unsigned char>(a[i])) !=
+            std::toupper(static_cast<unsigned char>(b[i])))
+            return false;
+    return true;
+}
+
 int cmd_exit(int argc, char **argv) {
     if (is_help_flag_present(argc, argv)) {
-        std::cout << "Run 'help exit' for information." << "\n";
+        cmd_out() << "Run 'help exit' for information." << "\n";
         return 0;
     }
+    if (refused_when_detached("EXIT"))
+        return 1;
     int code = 0;
     for (int i = 1; i < argc; ++i) {
         if (argv[i][0] != '/') {
@@ -312,11 +231,11 @@ int cmd_cls(int, char **) {
 
 int cmd_echo(int argc, char **argv) {
     if (is_help_flag_present(argc, argv)) {
-        std::cout << "Run 'help echo' for information." << "\n";
+        cmd_out() << "Run 'help echo' for information." << "\n";
         return 0;
     }
     if (argc == 1) {
-        std::cout << "ECHO is " << (echo_enabled ? "on" : "off") << "\n";
+        cmd_out() << "ECHO is " << (echo_enabled ? "on" : "off") << "\n";
         return 0;
     }
     std::string message;
@@ -325,48 +244,43 @@ int cmd_echo(int argc, char **argv) {
         if (i < argc - 1)
             message += " ";
     }
+    if ((message == "on" || message == "off") && refused_when_detached("ECHO ON and OFF"))
+        return 1;
     if (message == "on")
         echo_enabled = true;
     else if (message == "off")
         echo_enabled = false;
-    else if (message == ".")
-        std::cout << "\n";
     else
-        std::cout << message << "\n";
+        cmd_out() << message << "\n";
     return 0;
 }
 
 void print_drive_info(const std::string &path) {
-    char root[MAX_PATH]{0};
-    // Extract drive root, e.g., "C:\\"
-    if (path.size() >= 2 && path[1] == ':') {
-        std::snprintf(root, sizeof(root), "%c:\\", path[0]);
-    } else {
-        GetFullPathNameA(path.c_str(), MAX_PATH, root, nullptr);
-        root[3] = '\0'; // keep only drive root
-    }
-
-    char volumeName[MAX_PATH]{0};
-    DWORD serialNumber = 0;
-    if (GetVolumeInformationA(root, volumeName, sizeof(volumeName), &serialNumber, nullptr, nullptr,
-                              nullptr, 0)) {
-        std::cout << " Volume in drive " << (char)std::toupper(root[0]) << " is ";
-        if (volumeName[0])
-            std::cout << volumeName << "\n";
+    // Extract the drive letter of the directory being listed.
+    std::string full = canonicalize(path);
+    char drive = full.size() >= 2 && full[1] == ':'
+                     ? static_cast<char>(std::toupper(static_cast<unsigned char>(full[0])))
+                     : 0;
+
+    VolumeInfo volume;
+    if (drive && file_system().volume_info(drive, volume)) {
+        cmd_out() << " Volume in drive " << drive << " is ";
+        if (!volume.label.empty())
+            cmd_out() << volume.label << "\n";
         else
-            std::cout << "has no label.\n";
+            cmd_out() << "has no label.\n";
 
-        std::cout << " Volume Serial Number is " << std::uppercase << std::hex
-                  << ((serialNumber >> 16) & 0xFFFF) << "-" << (serialNumber & 0xFFFF) << std::dec
-                  << "\n\n";
+        cmd_out() << " Volume Serial Number is " << std::uppercase << std::hex
+                  << ((volume.serial >> 16) & 0xFFFF) << "-" << (volume.serial & 0xFFFF)
+                  << std::dec << "\n\n";
     } else {
-        std::cerr << "Unable to retrieve volume info.\n";
+        cmd_err() << "Unable to retrieve volume info.\n";
     }
 }
 
 int cmd_dir(int argc, char **argv) {
     if (is_help_flag_present(argc, argv)) {
-        std::cout << "Run 'help dir' for information." << "\n";
+        cmd_out() << "Run 'help dir' for information." << "\n";
         return 0;
     }
     bool show_hidden = false;
@@ -376,7 +290,6 @@ int cmd_dir(int argc, char **argv) {
         show_hidden = true;
     }
 
-    namespace fs = std::filesystem;
     std::string target = ".";
     for (int i = 1; i < argc; ++i) {
         if (argv[i][0] == '/')
@@ -388,98 +301,70 @@ int cmd_dir(int argc, char **argv) {
     uintmax_t total_size = 0;
     size_t file_count = 0, dir_count = 0;
 
-    auto print_entry = [&](const fs::path &path, bool is_dir) {
-        auto ftime = fs::last_write_time(path);
-        auto sctp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-            ftime - decltype(ftime)::clock::now() + std::chrono::system_clock::now());
-        std::time_t cftime = std::chrono::system_clock::to_time_t(sctp);
+    auto print_entry = [&](const FileEntry &entry, const char *name) {
+        std::time_t cftime = entry.mtime;
         std::tm tm{};
+#ifdef _WIN32
         localtime_s(&tm, &cftime);
+#else
+        localtime_r(&cftime, &tm);
+#endif
 
         char timebuf[32];
         std::strftime(timebuf, sizeof(timebuf), "%m-%d-%Y  %I:%M %p", &tm);
 
-        std::cout << timebuf << "  ";
-        if (is_dir) {
-            std::cout << std::setw(12) << std::left << "<DIR>";
+        cmd_out() << timebuf << "  ";
+        if (entry.is_dir) {
+            cmd_out() << std::setw(12) << std::left << "<DIR>";
             dir_count++;
         } else {
-            auto sz = fs::file_size(path);
-            std::cout << std::setw(12) << std::right << sz;
-            total_size += sz;
+            cmd_out() << std::setw(12) << std::right << entry.size;
+            total_size += entry.size;
             file_count++;
         }
-        std::cout << "  " << path.filename().string() << "\n";
+        cmd_out() << "  " << name << "\n";
     };
 
-    try {
-        std::filesystem::path currentPath;
-        try {
-            currentPath = std::filesystem::current_path();
-        } catch (...) {
-            return 1;
-        }
-
-        char cur_drive = 0;
-        {
-            auto root_name = currentPath.root_name().string();
-            if (!root_name.empty() && std::isalpha(static_cast<unsigned char>(root_name[0])))
-                cur_drive = std::toupper(static_cast<unsigned char>(root_name[0]));
-        }
-        if (cur_drive == 0 && !currentPath.string().empty())
-            cur_drive = std::toupper(static_cast<unsigned char>(currentPath.string()[0]));
-
-        std::string targetPath = target;
+    FileSystem &fs = file_system();
+    std::string dir = canonicalize(target);
+    FileEntry self;
+    if (!fs.stat(dir, self) || !self.is_dir) {
+        cmd_err() << "The system cannot find the path specified.\n";
+        return 1;
+    }
 
-        if (target == "\\" || target == "/") {
-            targetPath = std::string(1, cur_drive) + ":\\";
-        }
+    if (is_flag_present(argc, argv, "/b")) {
+        fs.list_dir(dir, [&](const FileEntry &entry) {
+            if (show_hidden || !entry.hidden)
+                cmd_out() << entry.name << "\n";
+        });
+        return 0;
+    }
 
-        if (!is_flag_present(argc, argv, "/b")) {
-            print_drive_info(targetPath);
-            std::cout << " Directory of " << canonicalize(targetPath) << "\n\n";
+    print_drive_info(dir);
+    cmd_out() << " Directory of " << dir << "\n\n";
 
-            print_entry(targetPath, true);
-            print_entry(targetPath + "/..", true);
+    print_entry(self, ".");
+    FileEntry parent;
+    if (fs.stat(canonicalize(dir + "\\.."), parent))
+        print_entry(parent, "..");
 
-            for (const auto &entry : fs::directory_iterator(targetPath)) {
-                if (!show_hidden) {
-                    DWORD attrs = GetFileAttributesW(entry.path().c_str());
-                    if (attrs == INVALID_FILE_ATTRIBUTES)
-                        continue;
-                    if (attrs & FILE_ATTRIBUTE_HIDDEN)
-                        continue;
-                }
-                print_entry(entry.path(), entry.is_directory());
-            }
+    fs.list_dir(dir, [&](const FileEntry &entry) {
+        if (show_hidden || !entry.hidden)
+            print_entry(entry, entry.name.c_str());
+    });
 
-            std::cout << "              " << file_count << " File(s)    " << total_size
-                      << " bytes\n";
-            std::cout << "              " << dir_count << " Dir(s)\n";
-        } else {
-            for (const auto &entry : std::filesystem::directory_iterator(".")) {
-                if (!show_hidden) {
-                    DWORD attrs = GetFileAttributesW(entry.path().c_str());
-                    if (attrs == INVALID_FILE_ATTRIBUTES)
-                        continue;
-                    if (attrs & FILE_ATTRIBUTE_HIDDEN)
-                        continue;
-                }
-                std::wcout << entry.path().filename().wstring() << L"\n";
-            }
-        }
-        return 0;
-    } catch (const fs::filesystem_error &) {
-        std::cerr << "The system cannot find the path specified.\n";
-        return 1;
-    }
+    cmd_out() << "              " << file_count << " File(s)    " << total_size << " bytes\n";
+    cmd_out() << "              " << dir_count << " Dir(s)\n";
+    return 0;
 }
 
 int cmd_ver(int argc, char **argv) {
     if (is_help_flag_present(argc, argv)) {
-        std::cout << "Run 'help ver' for information." << "\n";
+        cmd_out() << "Run 'help ver' for information." << "\n";
         return 0;
     }
+#ifdef _WIN32
     DWORD major = 0, minor = 0, build = 0, ubr = 0;
     HMODULE hMod = ::GetModuleHandleW(L"ntdll.dll");
     if (hMod) {
@@ -503,31 +388,38 @@ int cmd_ver(int argc, char **argv) {
         RegGetValueW(hKey, nullptr, L"UBR", RRF_RT_REG_DWORD, nullptr, &ubr, &ubrSize);
         RegCloseKey(hKey);
     }
-    std::cout << "Microsoft Windows [Version " << major << "." << minor << "." << build << "."
+    cmd_out() << "Microsoft Windows [Version " << major << "." << minor << "." << build << "."
               << ubr << "]" << "\n";
+#else
+    struct utsname name {};
+    uname(&name);
+    cmd_out() << name.sysname << " [Version " << name.release << "]" << "\n";
+#endif
     return 0;
 }
 
 int cmd_openver(int argc, char **argv) {
     if (is_help_flag_present(argc, argv)) {
-        std::cout << "Run 'help ver' for information." << "\n";
+        cmd_out() << "Run 'help ver' for information." << "\n";
         return 0;
     }
 
-    std::cout << "OpenCMD " << VERSION
+    cmd_out() << "OpenCMD " << VERSION
               << ". Visit https://www.gnu.org/licenses/gpl-3.0.en.html#license-text.\n";
 
     return 0;
 }
 
-static std::string drive_dirs[26];
+// The per-drive directories are shared copy-on-write with the SETLOCAL scopes that saved them, so
+// SETLOCAL only copies a pointer and the first CD afterwards pays for the copy.
+using DriveDirs = std::array<std::string, 26>;
+static std::shared_ptr<DriveDirs> drive_dirs;
 static bool drive_dirs_initialized = false;
 
 static void init_drive_dirs() {
     if (drive_dirs_initialized)
         return;
-    for (auto &s : drive_dirs)
-        s.clear();
+    drive_dirs = std::make_shared<DriveDirs>();
     drive_dirs_initialized = true;
 }
 
@@ -538,7 +430,9 @@ void set_drive_dir(char drive, const char *path) {
     int idx = std::toupper(static_cast<unsigned char>(drive)) - 'A';
     if (idx < 0 || idx >= 26)
         return;
-    drive_dirs[idx] = path;
+    if (drive_dirs.use_count() > 1)
+        drive_dirs = std::make_shared<DriveDirs>(*drive_dirs);
+    (*drive_dirs)[idx] = path;
 }
 
 const char *get_drive_dir(char drive) {
@@ -548,7 +442,31 @@ const char *get_drive_dir(char drive) {
     int idx = std::toupper(static_cast<unsigned char>(drive)) - 'A';
     if (idx < 0 || idx >= 26)
         return nullptr;
-    return drive_dirs[idx].empty() ? nullptr : drive_dirs[idx].c_str();
+    const std::string &dir = (*drive_dirs)[idx];
+    return dir.empty() ? nullptr : dir.c_str();
+}
+
+// The current directory only changes through CD, so it is cached here and refreshed lazily after
+// CD bumps the generation. Callers that render it repeatedly (the prompt) compare generations to
+// avoid asking the file system again.
+static std::mutex cwd_mutex;
+static std::string cwd_cache;
+static unsigned cwd_cache_generation = 0;
+static std::atomic<unsigned> cwd_generation{1};
+
+unsigned current_directory_generation() { return cwd_generation.load(); }
+
+void invalidate_current_directory() { ++cwd_generation; }
+
+std::string current_directory() {
+    std::lock_guard<std::mutex> lock(cwd_mutex);
+    unsigned generation = cwd_generation.load();
+    if (cwd_cache_generation != generation) {
+        if (!file_system().get_current_dir(cwd_cache))
+            cwd_cache.clear();
+        cwd_cache_generation = generation;
+    }
+    return cwd_cache;
 }
 
 std::string strip_quotes(const std::string &s) {
@@ -561,17 +479,18 @@ std::string strip_quotes(const std::string &s) {
 
 int cmd_cd(int argc, char **argv) {
     if (is_help_flag_present(argc, argv)) {
-        std::cout << "Run 'help cd' for information." << "\n";
+        cmd_out() << "Run 'help cd' for information." << "\n";
         return 0;
     }
-    std::filesystem::path currentPath;
-    try {
-        currentPath = std::filesystem::current_path();
-    } catch (...) {
+    struct CwdInvalidator {
+        ~CwdInvalidator() { invalidate_current_directory(); }
+    } invalidate_on_return;
+    FileSystem &fs = file_system();
+    std::string currentPath;
+    if (!fs.get_current_dir(currentPath))
         return 1;
-    }
     if (argc == 1) {
-        std::cout << currentPath.string() << "\n";
+        cmd_out() << currentPath << "\n";
         return 0;
     }
     bool switch_drive = false;
@@ -589,106 +508,472 @@ int cmd_cd(int argc, char **argv) {
         }
     }
     if (!arg) {
-        std::cout << currentPath.string() << "\n";
+        cmd_out() << currentPath << "\n";
         return 0;
     }
-    std::unique_ptr<char, decltype(&std::free)> argcopy(_strdup(arg), &std::free);
-    std::string target = trimString(argcopy.get());
+    if (refused_when_detached("CD"))
+        return 1;
+    std::string argcopy = arg;
+    std::string target = trimString(argcopy.data());
     bool has_drive = target.size() >= 2 && std::isalpha(static_cast<unsigned char>(target[0])) &&
                      target[1] == ':';
     char cur_drive = 0;
-    {
-        auto root_name = currentPath.root_name().string();
-        if (!root_name.empty() && std::isalpha(static_cast<unsigned char>(root_name[0])))
-            cur_drive = std::toupper(static_cast<unsigned char>(root_name[0]));
-    }
-    if (cur_drive == 0 && !currentPath.string().empty())
-        cur_drive = std::toupper(static_cast<unsigned char>(currentPath.string()[0]));
+    if (!currentPath.empty() && std::isalpha(static_cast<unsigned char>(currentPath[0])))
+        cur_drive = std::toupper(static_cast<unsigned char>(currentPath[0]));
     char prev_drive = cur_drive;
     std::string saved_prev_dir;
     if (cur_drive >= 'A' && cur_drive <= 'Z') {
         const char *p = get_drive_dir(cur_drive);
-        saved_prev_dir = p ? p : currentPath.string();
-    }
-    set_drive_dir(cur_drive, currentPath.string().c_str());
-    try {
-        if (!has_drive) {
-            if (target == "\\" || target == "/") {
-                std::string root = std::string(1, cur_drive) + ":\\";
-                try {
-                    std::filesystem::current_path(root);
-                } catch (...) {
-                    std::cerr << "The system could not find the path specified." << "\n";
-                    return 1;
-                }
-                std::filesystem::path newDir = std::filesystem::current_path();
-                set_drive_dir(cur_drive, newDir.string().c_str());
-                return 0;
+        saved_prev_dir = p ? p : currentPath;
+    }
+    set_drive_dir(cur_drive, currentPath.c_str());
+
+    // Changes directory and records where the OS says we ended up, which has the on-disk case.
+    auto change_to = [&](const std::string &path, char drive) {
+        if (!fs.set_current_dir(path))
+            return false;
+        std::string newDir;
+        set_drive_dir(drive, fs.get_current_dir(newDir) ? newDir.c_str() : path.c_str());
+        return true;
+    };
+
+    if (!has_drive) {
+        if (!change_to(canonicalize(target), cur_drive)) {
+            cmd_err() << "The system could not find the path specified." << "\n";
+            return 1;
+        }
+        return 0;
+    }
+    char target_drive = std::toupper(static_cast<unsigned char>(target[0]));
+    const char *after_colon = target.c_str() + 2;
+    if (*after_colon == '\0') {
+        const char *saved = get_drive_dir(target_drive);
+        std::string buf = saved ? saved : std::string(1, target_drive) + ":\\";
+        if (switch_drive)
+            return change_to(buf, target_drive) ? 0 : 1;
+        cmd_out() << buf << "\n";
+        return 0;
+    }
+    if (*after_colon == '\\' || *after_colon == '/') {
+        if (!change_to(canonicalize(target), target_drive)) {
+            cmd_err() << "The system could not find the path specified." << "\n";
+            return 1;
+        }
+        // Without /D, CD on another drive only changes that drive's remembered directory.
+        if (!switch_drive && target_drive != prev_drive) {
+            if (saved_prev_dir.empty() || !fs.set_current_dir(saved_prev_dir))
+                fs.set_current_dir(std::string(1, prev_drive) + ":\\");
+        }
+        return 0;
+    }
+    cmd_err() << "Invalid path syntax." << "\n";
+    return 1;
+}
+
+// Splits the parenthesized FOR set into items and expands wildcards against the file system. Like
+// CMD, wildcards only match files, and hidden files are skipped.
+static std::vector<std::string> expand_for_set(const std::string &set) {
+    std::vector<std::string> items;
+    size_t i = 0;
+    while (i < set.size()) {
+        while (i < set.size() && (std::isspace(static_cast<unsigned char>(set[i])) ||
+                                  set[i] == ',' || set[i] == ';'))
+            ++i;
+        if (i >= set.size())
+            break;
+        std::string item;
+        bool quoted = false;
+        while (i < set.size()) {
+            char c = set[i];
+            if (c == '"')
+                quoted = !quoted;
+            else if (!quoted &&
+                     (std::isspace(static_cast<unsigned char>(c)) || c == ',' || c == ';'))
+                break;
+            else
+                item.push_back(c);
+            ++i;
+        }
+        if (item.find_first_of("*?") == std::string::npos) {
+            items.push_back(item);
+            continue;
+        }
+        size_t slash = item.find_last_of("\\/");
+        std::string prefix = slash == std::string::npos ? "" : item.substr(0, slash + 1);
+        std::string pattern = item.substr(prefix.size());
+        file_system().list_dir(canonicalize(prefix.empty() ? "." : prefix),
+                               [&](const FileEntry &entry) {
+                                   if (entry.is_dir || entry.hidden)
+                                       return;
+                                   if (wildcard_match(pattern.c_str(), entry.name.c_str()))
+                                       items.push_back(prefix + entry.name);
+                               });
+    }
+    return items;
+}
+
+// Replaces %%v (batch form) and %v (interactive form) with the current item.
+static std::string substitute_for_var(const std::string &body, char var, const std::string &value) {
+    std::string out;
+    out.reserve(body.size() + value.size());
+    for (size_t i = 0; i < body.size(); ++i) {
+        if (body[i] == '%') {
+            if (i + 2 < body.size() && body[i + 1] == '%' && body[i + 2] == var) {
+                out += value;
+                i += 2;
+                continue;
             }
-            std::filesystem::path joined = currentPath / std::filesystem::path(target);
-            std::filesystem::path canon = std::filesystem::weakly_canonical(joined);
-            try {
-                std::filesystem::current_path(canon);
-            } catch (...) {
-                std::cerr << "The system could not find the path specified." << "\n";
-                return 1;
+            if (i + 1 < body.size() && body[i + 1] == var) {
+                out += value;
+                i += 1;
+                continue;
             }
-            std::filesystem::path newDir = std::filesystem::current_path();
-            set_drive_dir(cur_drive, newDir.string().c_str());
-            return 0;
         }
-        char target_drive = std::toupper(static_cast<unsigned char>(target[0]));
-        const char *after_colon = target.c_str() + 2;
-        if (*after_colon == '\0') {
-            if (switch_drive) {
-                const char *saved = get_drive_dir(target_drive);
-                std::string buf = saved ? saved : std::string(1, target_drive) + ":\\";
-                try {
-                    std::filesystem::current_path(buf);
-                } catch (...) {
-                    return 1;
-                }
-                std::filesystem::path newDir = std::filesystem::current_path();
-                set_drive_dir(target_drive, newDir.string().c_str());
-                return 0;
-            } else {
-                const char *saved = get_drive_dir(target_drive);
-                std::cout << (saved ? saved : (std::string(1, target_drive) + ":\\")) << "\n";
-                return 0;
-            }
+        out.push_back(body[i]);
+    }
+    return out;
+}
+
+int cmd_prompt(int argc, char **argv) {
+    if (is_help_flag_present(argc, argv)) {
+        cmd_out() << "Run 'help prompt' for information." << "\n";
+        return 0;
+    }
+    if (refused_when_detached("PROMPT"))
+        return 1;
+    std::string spec;
+    for (int i = 1; i < argc; ++i) {
+        if (i > 1)
+            spec += ' ';
+        spec += argv[i];
+    }
+    if (spec.empty())
+        spec = default_prompt;
+    set_env_var("PROMPT", spec);
+    set_prompt(spec);
+    return 0;
+}
+
+// PROMPT is an ordinary variable, so SET and ENDLOCAL can change it too.
+static void sync_prompt_from_env() {
+    std::string spec;
+    set_prompt(get_env_var("PROMPT", spec) ? spec : std::string(default_prompt));
+}
+
+int cmd_set(int argc, char **argv) {
+    if (is_help_flag_present(argc, argv)) {
+        cmd_out() << "Run 'help set' for information." << "\n";
+        return 0;
+    }
+    if (argc > 1 && argv[1][0] == '/') {
+        cmd_err() << "Invalid switch - " << argv[1] << "\n";
+        return 1;
+    }
+    std::string arg;
+    for (int i = 1; i < argc; ++i) {
+        if (i > 1)
+            arg += ' ';
+        arg += argv[i];
+    }
+    size_t eq = arg.find('=');
+    if (eq == std::string::npos) {
+        bool found = false;
+        for_each_env_var(arg, [&](const std::string &name, const std::string &value) {
+            cmd_out() << name << "=" << value << "\n";
+            found = true;
+        });
+        if (!found) {
+            cmd_err() << "Environment variable " << arg << " not defined\n";
+            return 1;
+        }
+        return 0;
+    }
+    if (eq == 0) {
+        cmd_err() << "The syntax of the command is incorrect.\n";
+        return 1;
+    }
+    std::string name = arg.substr(0, eq);
+    if (iequals(name, "PROMPT") && refused_when_detached("SET PROMPT"))
+        return 1;
+    set_env_var(name, arg.substr(eq + 1));
+    if (iequals(name, "PROMPT"))
+        sync_prompt_from_env();
+    return 0;
+}
+
+// SETLOCAL saves the variables, the current directory and the per-drive directories. All three
+// are kept by pointer or by value of a single string, so entering and leaving a scope costs the
+// same no matter how many variables are defined.
+struct LocalScope {
+    EnvSnapshot env;
+    std::string cwd;
+    std::shared_ptr<DriveDirs> drives;
+};
+
+static std::mutex local_scopes_mutex;
+static std::vector<LocalScope> local_scopes;
+
+int cmd_setlocal(int argc, char **argv) {
+    if (is_help_flag_present(argc, argv)) {
+        cmd_out() << "Run 'help setlocal' for information." << "\n";
+        return 0;
+    }
+    if (refused_when_detached("SETLOCAL"))
+        return 1;
+    for (int i = 1; i < argc; ++i) {
+        if (!iequals(argv[i], "ENABLEEXTENSIONS") && !iequals(argv[i], "DISABLEEXTENSIONS") &&
+            !iequals(argv[i], "ENABLEDELAYEDEXPANSION") &&
+            !iequals(argv[i], "DISABLEDELAYEDEXPANSION")) {
+            cmd_err() << "Invalid parameter - " << argv[i] << "\n";
+            return 1;
         }
-        if (*after_colon == '\\' || *after_colon == '/') {
-            std::filesystem::path p(target);
-            std::filesystem::path canon = std::filesystem::weakly_canonical(p);
-            try {
-                std::filesystem::current_path(canon);
-            } catch (...) {
+    }
+    init_drive_dirs();
+    LocalScope scope{env_snapshot(), current_directory(), drive_dirs};
+    std::lock_guard<std::mutex> lock(local_scopes_mutex);
+    local_scopes.push_back(std::move(scope));
+    return 0;
+}
+
+int cmd_endlocal(int argc, char **argv) {
+    if (is_help_flag_present(argc, argv)) {
+        cmd_out() << "Run 'help endlocal' for information." << "\n";
+        return 0;
+    }
+    if (refused_when_detached("ENDLOCAL"))
+        return 1;
+    LocalScope scope;
+    {
+        std::lock_guard<std::mutex> lock(local_scopes_mutex);
+        if (local_scopes.empty())
+            return 0;
+        scope = std::move(local_scopes.back());
+        local_scopes.pop_back();
+    }
+    env_restore(scope.env);
+    drive_dirs = std::move(scope.drives);
+    if (!scope.cwd.empty() && scope.cwd != current_directory()) {
+        file_system().set_current_dir(scope.cwd);
+        invalidate_current_directory();
+    }
+    sync_prompt_from_env();
+    return 0;
+}
+
+int cmd_sort(int argc, char **argv) {
+    if (is_help_flag_present(argc, argv)) {
+        cmd_out() << "Run 'help sort' for information." << "\n";
+        return 0;
+    }
+    SortOptions options;
+    std::string input, output;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg[0] != '/') {
+            if (!input.empty()) {
+                cmd_err() << "Too many parameters - " << arg << "\n";
                 return 1;
             }
-            std::filesystem::path newDir = std::filesystem::current_path();
-            set_drive_dir(target_drive, newDir.string().c_str());
-            if (!switch_drive && target_drive != prev_drive) {
-                if (!saved_prev_dir.empty()) {
-                    try {
-                        std::filesystem::current_path(saved_prev_dir);
-                    } catch (...) {
-                        std::filesystem::path root(std::string(1, prev_drive) + ":\\");
-                        std::filesystem::current_path(root);
-                    }
-                } else {
-                    std::filesystem::path root(std::string(1, prev_drive) + ":\\");
-                    std::filesystem::current_path(root);
-                }
-                return 0;
+            input = arg;
+        } else if (iequals(arg, "/R") || iequals(arg, "/REVERSE")) {
+            options.reverse = true;
+        } else if (arg.size() > 2 && arg[1] == '+') {
+            int column = std::atoi(arg.c_str() + 2);
+            if (column < 1) {
+                cmd_err() << "Invalid switch.\n";
+                return 1;
             }
-            return 0;
+            options.column = static_cast<size_t>(column - 1);
+        } else if ((iequals(arg, "/O") || iequals(arg, "/OUTPUT")) && i + 1 < argc) {
+            output = argv[++i];
+        } else if ((iequals(arg, "/T") || iequals(arg, "/TEMPORARY")) && i + 1 < argc) {
+            options.temp_dir = argv[++i];
+        } else if ((iequals(arg, "/M") || iequals(arg, "/MEMORY")) && i + 1 < argc) {
+            unsigned long long kb = std::strtoull(argv[++i], nullptr, 10);
+            if (kb == 0) {
+                cmd_err() << "Invalid switch.\n";
+                return 1;
+            }
+            options.memory_limit = static_cast<size_t>(kb) * 1024;
+        } else {
+            cmd_err() << "Invalid switch.\n";
+            return 1;
         }
-        std::cerr << "Invalid path syntax." << "\n";
-        return 1;
-    } catch (const std::filesystem::filesystem_error &) {
-        std::cerr << "The system could not find the path specified." << "\n";
+    }
+
+    NativeHandle in = streams.in_handle != no_handle ? streams.in_handle : std_handle(0);
+    NativeHandle opened = no_handle;
+    if (!input.empty()) {
+        opened = open_for_reading(input);
+        if (opened == no_handle) {
+            cmd_err() << "The system cannot find the file specified.\n";
+            return 1;
+        }
+        in = opened;
+    }
+    std::unique_ptr<FileOutputStream> out_file;
+    if (!output.empty()) {
+        out_file = std::make_unique<FileOutputStream>(output, false);
+        if (!out_file->is_open()) {
+            if (opened != no_handle)
+                close_handle(opened);
+            cmd_err() << "The system cannot find the path specified.\n";
+            return 1;
+        }
+    }
+
+    std::string error;
+    bool ok = sort_lines(in, out_file ? *out_file : cmd_out(), options, error);
+    if (opened != no_handle)
+        close_handle(opened);
+    if (!ok) {
+        cmd_err() << error << "\n";
         return 1;
     }
+    return 0;
+}
+
+static void print_alloc_stats_json(const std::vector<AllocStats> &stats, uint64_t peak_rss) {
+    std::ostream &out = cmd_out();
+    out << "{\"enabled\":" << (alloc_stats_enabled ? "true" : "false")
+        << ",\"peak_rss\":" << peak_rss << ",\"scopes\":[";
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const AllocStats &s = stats[i];
+        out << (i ? "," : "") << "{\"name\":\"" << s.name << "\",\"allocations\":" << s.allocations
+            << ",\"frees\":" << s.frees << ",\"bytes\":" << s.bytes << ",\"live\":" << s.live
+            << ",\"peak\":" << s.peak << "}";
+    }
+    out << "]}\n";
+}
+
+static void print_alloc_stats_table(const std::vector<AllocStats> &stats, uint64_t peak_rss) {
+    std::ostream &out = cmd_out();
+    if (!alloc_stats_enabled) {
+        out << "Allocation statistics were not compiled in; build with ALLOC_STATS=1.\n";
+    } else {
+        out << std::left << std::setw(12) << "Scope" << std::right << std::setw(12) << "Allocs"
+            << std::setw(12) << "Frees" << std::setw(16) << "Bytes" << std::setw(14) << "Live"
+            << std::setw(14) << "Peak" << "\n";
+        for (const AllocStats &s : stats)
+            out << std::left << std::setw(12) << s.name << std::right << std::setw(12)
+                << s.allocations << std::setw(12) << s.frees << std::setw(16) << s.bytes
+                << std::setw(14) << s.live << std::setw(14) << s.peak << "\n";
+        out << "\n";
+    }
+    out << "Peak working set: " << peak_rss / 1024 << " KB\n";
+}
+
+int cmd_stats(int argc, char **argv) {
+    if (is_help_flag_present(argc, argv)) {
+        cmd_out() << "Run 'help stats' for information." << "\n";
+        return 0;
+    }
+    bool json = false;
+    bool reset = false;
+    for (int i = 1; i < argc; ++i) {
+        if (iequals(argv[i], "/JSON")) {
+            json = true;
+        } else if (iequals(argv[i], "/RESET")) {
+            reset = true;
+        } else {
+            cmd_err() << "Invalid switch - " << argv[i] << "\n";
+            return 1;
+        }
+    }
+    std::vector<AllocStats> stats = alloc_stats();
+    if (json)
+        print_alloc_stats_json(stats, peak_rss_bytes());
+    else
+        print_alloc_stats_table(stats, peak_rss_bytes());
+    if (reset)
+        reset_alloc_stats();
+    return 0;
+}
+
+#ifndef _WIN32
+// A PATH inherited from a POSIX parent separates its directories with colons. Entries that start
+// with '/' are split at them and written as paths on drive C:, where the shell puts '/', so the
+// file system layer can look them up; drive-letter entries added by the shell keep their colons.
+static std::string split_posix_path(const std::string &path) {
+    std::string out;
+    out.reserve(path.size() + 16);
+    bool posix_entry = false;
+    for (size_t i = 0; i < path.size(); ++i) {
+        if (i == 0 || out.back() == ';') {
+            posix_entry = path[i] == '/';
+            if (posix_entry)
+                out += "C:";
+        }
+        if (posix_entry && path[i] == ':')
+            out += ';';
+        else if (posix_entry && path[i] == '/')
+            out += '\\';
+        else
+            out += path[i];
+    }
+    return out;
+}
+#endif
+
+// The shell's PATH as a list of ';'-separated directories, as WHERE and the program search read it.
+static std::string search_path() {
+    std::string path;
+    get_env_var("PATH", path);
+#ifndef _WIN32
+    path = split_posix_path(path);
+#endif
+    return path;
+}
+
+int cmd_where(int argc, char **argv) {
+    if (is_help_flag_present(argc, argv)) {
+        cmd_out() << "Run 'help where' for information." << "\n";
+        return 0;
+    }
+    WhereOptions options;
+    bool quiet = false;
+    std::vector<std::string> patterns;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg[0] != '/') {
+            patterns.push_back(strip_quotes(arg));
+        } else if (iequals(arg, "/Q")) {
+            quiet = true;
+        } else if (iequals(arg, "/R") && i + 1 < argc) {
+            options.root = canonicalize(strip_quotes(argv[++i]));
+        } else {
+            cmd_err() << "ERROR: Invalid argument or option - '" << arg << "'.\n";
+            return 2;
+        }
+    }
+    if (patterns.empty()) {
+        cmd_err() << "ERROR: A search pattern must be specified.\n";
+        return 2;
+    }
+    options.current_dir = current_directory();
+    options.path = search_path();
+    std::string pathext;
+    if (get_env_var("PATHEXT", pathext) && !pathext.empty())
+        options.pathext = pathext;
+
+    std::vector<std::vector<std::string>> matches;
+    std::string error;
+    if (!where_search(patterns, options, matches, error)) {
+        cmd_err() << "ERROR: " << error << "\n";
+        return 2;
+    }
+    bool all_found = true;
+    for (const auto &found : matches) {
+        all_found = all_found && !found.empty();
+        if (!quiet)
+            for (const std::string &path : found)
+                cmd_out() << path << "\n";
+    }
+    if (all_found)
+        return 0;
+    if (!quiet)
+        cmd_err() << "INFO: Could not find files for the given pattern(s).\n";
+    return 1;
 }
 
 struct Command {
@@ -703,9 +988,24 @@ struct Help {
 
 int cmd_help(int argc, char **argv);
 
-Command commands[] = {{"exit", cmd_exit},       {"cls", cmd_cls},   {"ver", cmd_ver},
-                      {"openver", cmd_openver}, {"help", cmd_help}, {"cd", cmd_cd},
-                      {"echo", cmd_echo},       {"dir", cmd_dir},   {nullptr, nullptr}};
+Command commands[] = {
+    {"exit", cmd_exit},
+    {"cls", cmd_cls},
+    {"ver", cmd_ver},
+    {"openver", cmd_openver},
+    {"help", cmd_help},
+    {"cd", cmd_cd},
+    {"echo", cmd_echo},
+    {"dir", cmd_dir},
+    {"prompt", cmd_prompt},
+    {"set", cmd_set},
+    {"setlocal", cmd_setlocal},
+    {"endlocal", cmd_endlocal},
+    {"sort", cmd_sort},
+    {"stats", cmd_stats},
+    {"where", cmd_where},
+    {nullptr, nullptr},
+};
 
 Help help_msgs[] = {
     {"Exits the program CMD.EXE or the current batch file.\n\nEXIT [code]\n\ncode: specifies an "
@@ -718,11 +1018,73 @@ Help help_msgs[] = {
      "path is provided, displays the current directory.\nSupports drive switching and remembers "
      "last directories per drive.\n",
      "cd"},
-    {"Displays messages, turns command echoing on or off.\n\nECHO [on | off | message | .]\n\non:  "
-     "enables echoing of commands\noff: disables echoing of commands\nmessage: prints the "
-     "specified message\n.: prints a blank line\nIf no arguments are provided, displays the "
-     "current echo state.\n",
+    {"Displays messages, turns command echoing on or off.\n\nECHO [on | off | message]\nECHO.[text]"
+     "\n\non:  enables echoing of commands\noff: disables echoing of commands\nmessage: prints the "
+     "specified message\nECHO.text: prints text with its spacing and quotes kept, or a blank line "
+     "if there is none; ECHO: and ECHO( work the same way\nIf no arguments are provided, displays "
+     "the current echo state.\n",
      "echo"},
+    {"Runs a specified command for each file in a set of files.\n\nFOR [/J[:n]] %variable IN (set) "
+     "DO command [command-parameters]\n\n%variable: a single letter replaceable parameter; use "
+     "%%variable in batch files.\n(set): one or more files or words, wildcards allowed.\ncommand: "
+     "the command to carry out for each item, or a parenthesized block.\n/J[:n]: runs the "
+     "iterations in parallel on at most n workers (default: one per processor).\n\nWithout "
+     "/J, the errorlevel is that of the last iteration. With /J, the output of\neach "
+     "iteration is buffered and written in set order, and the errorlevel is that of\nthe "
+     "first failing iteration in set order, or 0, however the iterations were\nscheduled. "
+     "Iterations run side by side in one shell, so CD with a path, SETLOCAL,\nENDLOCAL, "
+     "ECHO ON, ECHO OFF, PROMPT, SET PROMPT and EXIT fail inside a /J body.\n",
+     "for"},
+    {"Changes the command prompt.\n\nPROMPT [text]\n\ntext: specifies the new prompt. If "
+     "omitted, the prompt is reset to $P$G.\n\nText can contain the following codes:\n  $A  & "
+     "(ampersand)\n  $B  | (pipe)\n  $C  ( (left parenthesis)\n  $D  current date\n  $E  "
+     "escape code (ASCII code 27)\n  $F  ) (right parenthesis)\n  $G  > (greater-than "
+     "sign)\n  $H  backspace\n  $L  < (less-than sign)\n  $N  current drive\n  $P  current "
+     "drive and path\n  $Q  = (equal sign)\n  $S    (space)\n  $T  current time\n  $V  "
+     "OpenCMD version\n  $_  line break (carriage return and linefeed on Windows)\n  $$  $ "
+     "(dollar sign)\n",
+     "prompt"},
+    {"Displays, sets, or removes environment variables.\n\nSET [variable=[string]]\n\nvariable: "
+     "the environment variable name.\nstring: the value to assign. If omitted, the variable is "
+     "removed.\n\nSET without parameters displays all variables. SET with only a name displays "
+     "the\nvariables whose names start with it. %variable% on a command line is replaced "
+     "by\nits value.\n",
+     "set"},
+    {"Begins localization of environment changes.\n\nSETLOCAL [ENABLEEXTENSIONS | "
+     "DISABLEEXTENSIONS] [ENABLEDELAYEDEXPANSION | DISABLEDELAYEDEXPANSION]\n\nVariables, the "
+     "current directory and the remembered directory of each drive\nare restored by the "
+     "matching ENDLOCAL. The extension and delayed expansion\nkeywords are accepted for "
+     "compatibility.\n",
+     "setlocal"},
+    {"Ends localization of environment changes started by SETLOCAL.\n\nENDLOCAL\n\nRestores "
+     "the variables, current directory and per-drive directories saved by\nthe matching "
+     "SETLOCAL. Without a matching SETLOCAL it does nothing.\n",
+     "endlocal"},
+    {"Sorts input and writes the result to the screen, a file or another command.\n\nSORT "
+     "[/R] [/+n] [/M kilobytes] [/T path] [[drive:][path]filename] [/O "
+     "[drive:][path]filename]\n\n/R: reverses the sort order.\n/+n: compares lines from "
+     "character n on.\n/M kilobytes: the memory to use for sorting. Larger inputs are sorted "
+     "in\n  parts that are kept in temporary files and merged.\n/T path: the directory for "
+     "the temporary files (default: TEMP).\nfilename: the file to sort. Without it, standard "
+     "input is sorted, as in\n  'dir /b | sort'.\n/O filename: the file to write the result "
+     "to.\n\nLines compare without regard to case.\n",
+     "sort"},
+    {"Displays heap allocation statistics.\n\nSTATS [/JSON] [/RESET]\n\n/JSON: prints the "
+     "statistics as a JSON object.\n/RESET: clears the counts after printing them.\n\nFor "
+     "each phase of running a line (expand, tokenize, parse, execute) and each\nbuiltin, "
+     "shows the allocations and frees made, the bytes allocated, the bytes\nstill live and "
+     "the most that were live at once, followed by the peak working set.\nAllocation counts "
+     "are only available in builds made with ALLOC_STATS=1.\n",
+     "stats"},
+    {"Displays the location of files that match a search pattern.\n\nWHERE [/R dir] [/Q] "
+     "pattern...\n\n/R dir: searches the tree under dir instead of the current directory "
+     "and PATH.\n/Q: prints nothing; only the exit code tells whether every pattern "
+     "matched.\npattern: a file name, wildcards allowed. A name without an extension also "
+     "matches\n  it with each extension in PATHEXT.\n\nThe exit code is 0 when every "
+     "pattern matched, 1 when one did not and 2 on\nerrors. The names in each PATH "
+     "directory are remembered between runs and\nlisted again only after the directory "
+     "changes.\n",
+     "where"},
     {"Displays this help information.\n\nHELP [command]\n\nIf no command is provided, lists all "
      "available commands.\nUse 'HELP <command>' for detailed information about a specific "
      "command.\n",
@@ -731,8 +1093,9 @@ Help help_msgs[] = {
 
 int cmd_help(int argc, char **argv) {
     if (argc == 1 || is_help_flag_present(argc, argv)) {
-        std::cout << "Available commands:\n\nhelp\nver\nopenver\ncls\nexit\ncd\necho\ndir\n\n";
-        std::cout << "Type help <command> for details.\n";
+        cmd_out() << "Available commands:\n\nhelp\nver\nopenver\ncls\nexit\ncd\necho\ndir\nfor\n"
+                     "prompt\nset\nsetlocal\nendlocal\nsort\nstats\nwhere\n\n";
+        cmd_out() << "Type help <command> for details.\n";
         return 0;
     }
     const char *sub = argv[1];
@@ -740,11 +1103,11 @@ int cmd_help(int argc, char **argv) {
         if (!h.cmd)
             break;
         if (std::strcmp(sub, h.cmd) == 0) {
-            std::cout << h.msg;
+            cmd_out() << h.msg;
             return 0;
         }
     }
-    std::cout << "No help available for: " << sub << "\n";
+    cmd_out() << "No help available for: " << sub << "\n";
     return 0;
 }
 
@@ -762,58 +1125,563 @@ char *trimString(char *str) {
     return s;
 }
 
-int run_command(const char *cmdline, int) {
-    if (!cmdline)
-        return -1;
-    if (!drive_dirs_initialized) {
-        char cwd[MAX_PATH]{0};
-        if (GetCurrentDirectoryA(MAX_PATH, cwd))
-            set_drive_dir(std::toupper(static_cast<unsigned char>(cwd[0])), cwd);
+static void drain_pipe(NativeHandle pipe, std::ostream &os) {
+    char buf[4096];
+    size_t got = 0;
+    while (read_handle(pipe, buf, sizeof(buf), got) && got > 0)
+        os.write(buf, static_cast<std::streamsize>(got));
+}
+
+// Finds the file a command name runs the way CMD does, rather than leaving it to CreateProcessW,
+// which would search the PATH the shell was started with: the current directory and then the
+// shell's PATH, trying a name without an extension with each PATHEXT extension. A name with a
+// directory in it is only looked for there.
+static bool find_program(const std::string &name, std::string &out) {
+    std::string pathext;
+    if (!get_env_var("PATHEXT", pathext) || pathext.empty())
+        pathext = ".COM;.EXE;.BAT;.CMD";
+    std::string base = strip_quotes(name);
+    std::vector<std::string> dirs;
+    if (base.find_first_of("\\/:") != std::string::npos) {
+        std::string full = canonicalize(base);
+        size_t slash = full.find_last_of('\\');
+        if (slash == std::string::npos || slash + 1 == full.size())
+            return false;
+        dirs.push_back(full.substr(0, slash + 1));
+        base = full.substr(slash + 1);
+    } else {
+        dirs = search_dirs(current_directory(), search_path());
     }
-    cmd::Tokenizer tok(cmdline);
-    std::vector<cmd::Token> tokens = tok.tokenize();
-    if (tokens.empty())
+    for (const std::string &dir : dirs) {
+        for (const std::string &candidate : candidates_for(base, pathext)) {
+#ifdef _WIN32
+            // Only files with an extension run; "python" alone is never a program.
+            if (candidate.find('.') == std::string::npos)
+                continue;
+#endif
+            std::string path = dir.back() == '\\' ? dir + candidate : dir + '\\' + candidate;
+            if (is_program_file(path)) {
+                out = std::move(path);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+#ifdef _WIN32
+using ChildProcess = HANDLE;
+
+// Serializes process creation. The handles a child is given are made inheritable only for the
+// duration of its CreateProcessW call, so a sibling started from another thread never inherits
+// pipes or redirection targets that were meant for it.
+static std::mutex spawn_mutex;
+
+// Starts program with in, out and err as its standard handles, which are only passed on when
+// redirected is set; otherwise the child shares the console.
+static bool start_child(const std::string &program, const std::string &cmdline,
+                        const std::vector<std::string> &, NativeHandle in, NativeHandle out,
+                        NativeHandle err, bool redirected, ChildProcess &child) {
+    std::wstring wide_program = widen(program);
+    // CreateProcessW may modify the command line buffer, so it gets its own copy.
+    std::wstring wide_cmdline = widen(cmdline);
+    STARTUPINFOW si{};
+    PROCESS_INFORMATION pi{};
+    si.cb = sizeof(si);
+    si.dwFlags |= redirected ? STARTF_USESTDHANDLES : 0;
+    si.hStdInput = in;
+    si.hStdOutput = out;
+    si.hStdError = err;
+
+    std::lock_guard<std::mutex> lock(spawn_mutex);
+    HANDLE inherited[] = {in, out, err};
+    DWORD flags[3] = {};
+    for (int i = 0; i < 3 && redirected; ++i) {
+        GetHandleInformation(inherited[i], &flags[i]);
+        SetHandleInformation(inherited[i], HANDLE_FLAG_INHERIT, HANDLE_FLAG_INHERIT);
+    }
+    BOOL started = FALSE;
+    // Children see the shell's variables, not the environment the shell was started with.
+    with_env_block([&](EnvBlock env) {
+        started = CreateProcessW(wide_program.c_str(), wide_cmdline.data(), nullptr, nullptr,
+                                 redirected ? TRUE : FALSE, CREATE_UNICODE_ENVIRONMENT, env,
+                                 nullptr, &si, &pi);
+    });
+    for (int i = 0; i < 3 && redirected; ++i)
+        SetHandleInformation(inherited[i], HANDLE_FLAG_INHERIT, flags[i] & HANDLE_FLAG_INHERIT);
+    if (!started)
+        return false;
+    CloseHandle(pi.hThread);
+    child = pi.hProcess;
+    return true;
+}
+
+static int wait_child(ChildProcess child) {
+    WaitForSingleObject(child, INFINITE);
+    DWORD exit_code = 0;
+    GetExitCodeProcess(child, &exit_code);
+    CloseHandle(child);
+    return static_cast<int>(exit_code);
+}
+#else
+using ChildProcess = pid_t;
+
+// Starts program with words as its arguments and in, out and err as its standard descriptors.
+// Every descriptor the shell opens itself is close-on-exec, so the child gets only these three.
+static bool start_child(const std::string &program, const std::string &,
+                        const std::vector<std::string> &words, NativeHandle in, NativeHandle out,
+                        NativeHandle err, bool, ChildProcess &child) {
+    std::string path = native_path(program);
+    std::vector<char *> argv;
+    std::vector<std::string> args = words;
+    for (std::string &arg : args)
+        argv.push_back(arg.data());
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, in, 0);
+    posix_spawn_file_actions_adddup2(&actions, out, 1);
+    posix_spawn_file_actions_adddup2(&actions, err, 2);
+    // The shell ignores SIGPIPE for its own pipes; a child starts with the default.
+    posix_spawnattr_t attr;
+    posix_spawnattr_init(&attr);
+    sigset_t defaults;
+    sigemptyset(&defaults);
+    sigaddset(&defaults, SIGPIPE);
+    posix_spawnattr_setsigdefault(&attr, &defaults);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF);
+    int rc = 0;
+    // Children see the shell's variables, not the environment the shell was started with.
+    with_env_block([&](EnvBlock env) {
+        rc = posix_spawn(&child, path.c_str(), &actions, &attr, argv.data(), env);
+    });
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    return rc == 0;
+}
+
+static int wait_child(ChildProcess child) {
+    int status = 0;
+    while (waitpid(child, &status, 0) < 0 && errno == EINTR) {
+    }
+    if (WIFEXITED(status))
+        return WEXITSTATUS(status);
+    return WIFSIGNALED(status) ? 128 + WTERMSIG(status) : -1;
+}
+#endif
+
+static int spawn_process(const std::vector<std::string> &words, const std::string &cmdline) {
+    std::string program;
+    if (!find_program(words[0], program)) {
+        cmd_err() << "'" << words[0]
+                  << "' is not recognized as an internal or external command.\n";
+        return 9009;
+    }
+
+    // Anything a builtin earlier on the line wrote to the same target has to land first.
+    cmd_out().flush();
+    cmd_err().flush();
+
+    bool pipe_out = streams.out_handle == no_handle && streams.out;
+    bool shared_pipe = pipe_out && streams.err_handle == no_handle && streams.err == streams.out;
+    bool pipe_err = streams.err_handle == no_handle && streams.err && !shared_pipe;
+    bool redirected = streams.in_handle != no_handle || streams.out_handle != no_handle ||
+                      streams.err_handle != no_handle || pipe_out || pipe_err;
+    NativeHandle out_read = no_handle, err_read = no_handle;
+    NativeHandle out_write = no_handle, err_write = no_handle;
+    if (pipe_out && !create_pipe(out_read, out_write))
         return -1;
-    cmd::Parser parser(tokens);
-    cmd::CommandAST ast = parser.parse();
-    if (ast.name.empty())
+    if (pipe_err && !create_pipe(err_read, err_write)) {
+        if (out_read != no_handle) {
+            close_handle(out_read);
+            close_handle(out_write);
+        }
         return -1;
-    std::vector<std::unique_ptr<char, decltype(&std::free)>> owned_strings;
-    std::vector<char *> argv;
-    {
-        char *s = _strdup(ast.name.c_str());
-        owned_strings.emplace_back(s, &std::free);
-        argv.push_back(s);
     }
-    for (auto &a : ast.args) {
-        char *s = _strdup(a.text.c_str());
-        owned_strings.emplace_back(s, &std::free);
-        argv.push_back(s);
+    NativeHandle child_out = pipe_out ? out_write : streams.out_handle;
+    NativeHandle child_err = shared_pipe ? out_write : pipe_err ? err_write : streams.err_handle;
+    ChildProcess child{};
+    bool started = start_child(
+        program, cmdline, words, streams.in_handle != no_handle ? streams.in_handle : std_handle(0),
+        child_out != no_handle ? child_out : std_handle(1),
+        child_err != no_handle ? child_err : std_handle(2), redirected, child);
+    if (out_write != no_handle)
+        close_handle(out_write);
+    if (err_write != no_handle)
+        close_handle(err_write);
+    if (!started) {
+        if (out_read != no_handle)
+            close_handle(out_read);
+        if (err_read != no_handle)
+            close_handle(err_read);
+        cmd_err() << "The system cannot execute the specified program.\n";
+        return 9009;
+    }
+    if (out_read != no_handle || err_read != no_handle) {
+        std::thread err_reader;
+        if (err_read != no_handle)
+            err_reader = std::thread(drain_pipe, err_read, std::ref(cmd_err()));
+        if (out_read != no_handle)
+            drain_pipe(out_read, cmd_out());
+        if (err_reader.joinable())
+            err_reader.join();
+        if (out_read != no_handle)
+            close_handle(out_read);
+        if (err_read != no_handle)
+            close_handle(err_read);
     }
+    return wait_child(child);
+}
+
+static std::atomic<int> last_errorlevel{0};
+
+// Phase 1 of CMD's parser: %NAME% becomes the value of the variable, and %CD% and %ERRORLEVEL%
+// the dynamic values unless a variable of that name is set. As on the interactive command line,
+// undefined names and lone percent signs are left as typed, which also keeps the %%v of a FOR
+// body intact for FOR to substitute.
+static std::string expand_variables(const char *line) {
+    const char *pct = std::strchr(line, '%');
+    if (!pct)
+        return line;
+    std::string out(line, pct);
+    std::string value;
+    while (pct) {
+        const char *close = std::strchr(pct + 1, '%');
+        if (!close)
+            break;
+        std::string name(pct + 1, close);
+        bool found = !name.empty() && get_env_var(name, value);
+        if (!found && iequals(name, "CD")) {
+            value = current_directory();
+            found = true;
+        } else if (!found && iequals(name, "ERRORLEVEL")) {
+            value = std::to_string(last_errorlevel.load());
+            found = true;
+        }
+        if (!found) {
+            out += '%';
+            line = pct + 1;
+        } else {
+            out += value;
+            line = close + 1;
+        }
+        pct = std::strchr(line, '%');
+        out.append(line, pct ? pct : line + std::strlen(line));
+    }
+    if (pct)
+        out += pct;
+    return out;
+}
+
+// The FOR variables in scope while a loop body runs, innermost first.
+struct ForBinding {
+    char var;
+    const std::string &value;
+    const ForBinding *outer;
+};
+
+static std::string bind_for_vars(const std::string &text, const ForBinding *binding) {
+    if (!binding || text.find('%') == std::string::npos)
+        return text;
+    std::string out = text;
+    for (; binding; binding = binding->outer)
+        out = substitute_for_var(out, binding->var, binding->value);
+    return out;
+}
+
+static int execute(const cmd::Node *node, const ForBinding *binding);
+
+static int execute_command(const cmd::CommandAST &ast, const ForBinding *binding) {
+    std::vector<std::string> words;
+    words.reserve(ast.args.size() + 1);
+    words.push_back(bind_for_vars(ast.name, binding));
+    for (const auto &a : ast.args)
+        words.push_back(bind_for_vars(a.text, binding));
+    std::vector<char *> argv;
+    argv.reserve(words.size() + 1);
+    for (auto &w : words)
+        argv.push_back(w.data());
     argv.push_back(nullptr);
     for (auto &c : commands) {
         if (!c.name)
             break;
         if (std::strcmp(argv[0], c.name) == 0) {
-            return c.handler(static_cast<int>(argv.size() - 1), argv.data());
+            AllocScope scope(c.name);
+            return c.handler(static_cast<int>(words.size()), argv.data());
+        }
+    }
+    AllocScope scope("external");
+
+    // A program gets its words back as one command line; words that were quoted or contain
+    // whitespace are quoted again.
+    std::string cmdline;
+    for (size_t i = 0; i < words.size(); ++i) {
+        bool quote = (i > 0 && ast.args[i - 1].quoted) ||
+                     words[i].find_first_of(" \t") != std::string::npos;
+        if (i > 0)
+            cmdline += ' ';
+        if (quote)
+            cmdline += '"';
+        cmdline += words[i];
+        if (quote)
+            cmdline += '"';
+    }
+    return spawn_process(words, cmdline);
+}
+
+// Points handle 1 or 2 (or 0, for input) of the running command somewhere else.
+static void set_std_stream(int handle, std::ostream *os, NativeHandle h) {
+    if (handle == 0) {
+        streams.in_handle = h;
+    } else if (handle == 1) {
+        streams.out = os;
+        streams.out_handle = h;
+    } else {
+        streams.err = os;
+        streams.err_handle = h;
+    }
+}
+
+// Applies the redirections left to right, so "> f 2>&1" sends both streams to f while "2>&1 > f"
+// leaves stderr where stdout was before. Everything is restored when the command finishes.
+static int execute_redirected(const cmd::Node &node, const ForBinding *binding) {
+    StdStreams saved = streams;
+    std::vector<std::unique_ptr<FileOutputStream>> files;
+    std::vector<NativeHandle> inputs;
+    auto restore = [&] {
+        streams = saved;
+        for (NativeHandle h : inputs)
+            close_handle(h);
+    };
+
+    for (const auto &r : node.redirections) {
+        // CMD's handles 3 to 9 have no stream behind them here.
+        if (r.handle > 2 || r.dup_handle > 2)
+            continue;
+        if (r.dup_handle >= 0) {
+            if (r.handle == 0 || r.dup_handle == 0)
+                continue;
+            bool from_out = r.dup_handle == 1;
+            std::ostream *os = from_out ? &cmd_out() : &cmd_err();
+            NativeHandle h = from_out ? streams.out_handle : streams.err_handle;
+            if (h == no_handle && os == (from_out ? &std::cout : &std::cerr))
+                h = std_handle(from_out ? 1 : 2);
+            set_std_stream(r.handle, os, h);
+            continue;
+        }
+        std::string target = bind_for_vars(r.target, binding);
+        if (r.input) {
+            NativeHandle h = open_for_reading(target);
+            if (h == no_handle) {
+                restore();
+                cmd_err() << "The system cannot find the file specified.\n";
+                return 1;
+            }
+            inputs.push_back(h);
+            set_std_stream(r.handle, nullptr, h);
+            continue;
+        }
+        auto file = std::make_unique<FileOutputStream>(target, r.append);
+        if (!file->is_open()) {
+            restore();
+            cmd_err() << (file->access_denied() ? "Access is denied.\n"
+                                                : "The system cannot find the path specified.\n");
+            return 1;
         }
+        set_std_stream(r.handle, file.get(), file->handle());
+        files.push_back(std::move(file));
+    }
+
+    int code = execute(node.left.get(), binding);
+    restore();
+    return code;
+}
+
+// Both sides of a pipe run at the same time, as in CMD: the left one on its own thread with its
+// standard output going into the pipe, the right one here with the pipe as its standard input.
+// The errorlevel is that of the right side.
+static int execute_pipe(const cmd::Node &node, const ForBinding *binding) {
+    NativeHandle read_end, write_end;
+    if (!create_pipe(read_end, write_end)) {
+        cmd_err() << "The pipe could not be created.\n";
+        return 1;
+    }
+    StdStreams parent = streams;
+    // Whatever the error stream is, the console's std::cerr included, it is not safe to write to
+    // from two threads. The left side's builtins write their errors to a buffer of its own, which
+    // is appended once the left side has finished. Programs it starts write to the error handle
+    // directly, the console's if the shell's errors go there.
+    std::ostringstream left_err;
+    NativeHandle left_err_handle = parent.err_handle;
+    if (!parent.err && left_err_handle == no_handle)
+        left_err_handle = std_handle(2);
+
+    // CMD runs each side of a pipe in a shell of its own, so neither can change the state of this
+    // one; here the left side runs on a thread next to the right, and both are kept from it.
+    std::thread writer([&] {
+        FileOutputStream pipe_out(write_end);
+        detached_context = "a pipe";
+        streams = parent;
+        streams.out = &pipe_out;
+        streams.out_handle = write_end;
+        streams.err = &left_err;
+        streams.err_handle = left_err_handle;
+        execute(node.left.get(), binding);
+        // Leaving the scope flushes and closes the write end, which the reader sees as the end.
+    });
+
+    const char *saved_context = detached_context;
+    detached_context = "a pipe";
+    streams.in_handle = read_end;
+    int code = execute(node.right.get(), binding);
+    streams = parent;
+    detached_context = saved_context;
+    // A reader that stopped early must not leave the writer blocked on a full pipe.
+    close_handle(read_end);
+    writer.join();
+    cmd_err() << left_err.view();
+    return code;
+}
+
+static int execute_for(const cmd::Node &node, const ForBinding *binding) {
+    const cmd::ForLoop &loop = node.loop;
+    std::string set;
+    for (const auto &item : loop.set) {
+        if (!set.empty())
+            set += ' ';
+        if (item.quoted)
+            set += '"' + bind_for_vars(item.text, binding) + '"';
+        else
+            set += bind_for_vars(item.text, binding);
     }
-    std::unique_ptr<char, decltype(&std::free)> cmd_copy(_strdup(cmdline), &std::free);
-    if (!cmd_copy)
+    std::vector<std::string> items = expand_for_set(set);
+    const cmd::Node *body = node.left.get();
+
+    // Sequential FOR keeps CMD semantics: bodies share the console and the errorlevel is that of
+    // the last iteration.
+    if (!loop.parallel) {
+        int errorlevel = 0;
+        for (const auto &item : items) {
+            ForBinding inner{loop.var, item, binding};
+            errorlevel = execute(body, &inner);
+        }
+        return errorlevel;
+    }
+
+    // Parallel FOR runs each body on the pool with its output captured, then replays the captured
+    // output strictly in iteration order as soon as each prefix of iterations has finished. The
+    // errorlevel is that of the first iteration (in set order) that failed, or 0 when all of them
+    // succeeded, so the result does not depend on scheduling.
+    struct Iteration {
+        CapturedOutput output;
+        int code = 0;
+        bool done = false;
+    };
+    std::vector<Iteration> results(items.size());
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    NativeHandle input = streams.in_handle;
+
+    WorkerPool pool(loop.jobs, items.size(), [&](size_t k) {
+        StdStreams saved = streams;
+        const char *saved_context = detached_context;
+        streams = StdStreams{&results[k].output.out, &results[k].output.err, input};
+        detached_context = "FOR /J";
+        ForBinding inner{loop.var, items[k], binding};
+        int code;
+        try {
+            code = execute(body, &inner);
+        } catch (...) {
+            code = 1;
+        }
+        streams = saved;
+        detached_context = saved_context;
+        {
+            std::lock_guard<std::mutex> lock(done_mutex);
+            results[k].code = code;
+            results[k].done = true;
+        }
+        done_cv.notify_all();
+    });
+
+    int errorlevel = 0;
+    for (auto &r : results) {
+        {
+            std::unique_lock<std::mutex> lock(done_mutex);
+            done_cv.wait(lock, [&] { return r.done; });
+        }
+        cmd_out() << r.output.out.view();
+        cmd_err() << r.output.err.view();
+        r.output.out.str(std::string());
+        r.output.err.str(std::string());
+        if (errorlevel == 0 && r.code != 0)
+            errorlevel = r.code;
+    }
+    pool.wait();
+    return errorlevel;
+}
+
+// Runs a parsed line. && runs its right side only when the left one succeeded and || only when it
+// failed; either way the errorlevel is that of the last command that ran.
+static int execute(const cmd::Node *node, const ForBinding *binding) {
+    // An empty block, "()", does nothing.
+    if (!node)
+        return 0;
+    switch (node->kind) {
+    case cmd::NodeKind::Command:
+        return execute_command(node->command, binding);
+    case cmd::NodeKind::Sequence:
+        execute(node->left.get(), binding);
+        return execute(node->right.get(), binding);
+    case cmd::NodeKind::And: {
+        int code = execute(node->left.get(), binding);
+        return code == 0 ? execute(node->right.get(), binding) : code;
+    }
+    case cmd::NodeKind::Or: {
+        int code = execute(node->left.get(), binding);
+        return code != 0 ? execute(node->right.get(), binding) : code;
+    }
+    case cmd::NodeKind::Pipe:
+        return execute_pipe(*node, binding);
+    case cmd::NodeKind::Block:
+        return execute(node->left.get(), binding);
+    case cmd::NodeKind::Redirect:
+        return execute_redirected(*node, binding);
+    case cmd::NodeKind::For:
+        return execute_for(*node, binding);
+    }
+    return 0;
+}
+
+// Runs one command line, which may span several lines when a parenthesized block was continued.
+// The line is expanded and parsed once; the whole tree then runs without going back to the text.
+int run_command(const char *cmdline, int) {
+    if (!cmdline)
         return -1;
-    trimString(cmd_copy.get());
-    STARTUPINFOA si{};
-    PROCESS_INFORMATION pi{};
-    si.cb = sizeof(si);
-    if (!CreateProcessA(nullptr, cmd_copy.get(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &si,
-                        &pi)) {
-        std::cerr << "'" << argv[0] << "' is not recognized as an internal or external command.\n";
-        return 9009;
+    if (!drive_dirs_initialized) {
+        std::string cwd = current_directory();
+        if (!cwd.empty())
+            set_drive_dir(std::toupper(static_cast<unsigned char>(cwd[0])), cwd.c_str());
     }
-    WaitForSingleObject(pi.hProcess, INFINITE);
-    DWORD exit_code;
-    GetExitCodeProcess(pi.hProcess, &exit_code);
-    CloseHandle(pi.hProcess);
-    CloseHandle(pi.hThread);
-    return static_cast<int>(exit_code);
+    AllocScope phase("expand");
+    std::string expanded = expand_variables(cmdline);
+    phase.enter("tokenize");
+    cmd::Tokenizer tok(expanded.c_str());
+    std::vector<cmd::Token> tokens = tok.tokenize();
+    if (tokens.empty())
+        return -1;
+    phase.enter("parse");
+    cmd::Parser parser(tokens);
+    std::unique_ptr<cmd::Node> tree = parser.parse();
+    phase.enter("execute");
+    int code;
+    if (!tree && !parser.error().empty()) {
+        cmd_err() << parser.error() << "\n";
+        code = 255;
+    } else {
+        code = execute(tree.get(), nullptr);
+    }
+    last_errorlevel = code;
+    return code;
 }
@@ -1,20 +1,65 @@
 #include "macros.hpp"
+#include "prompt.hpp"
 #include "run_command.hpp"
+#include "utf.hpp"
+#include <clocale>
 #include <iostream>
 #include <memory>
 #include <string>
-#include <windows.h>
 
-#ifndef PATH_MAX
-#define PATH_MAX MAX_PATH
+#ifdef _WIN32
+#include <windows.h>
 #endif
 
 bool echo_enabled = true;
-std::string custom_prompt;
+
+// Reading the console through the narrow API loses non-ASCII input even with the UTF-8 code page
+// selected, so interactive input is read as UTF-16 and converted. Redirected input is already a
+// byte stream and goes through std::cin.
+static bool read_line(std::string &line) {
+#ifdef _WIN32
+    HANDLE in = GetStdHandle(STD_INPUT_HANDLE);
+    DWORD mode = 0;
+    if (!GetConsoleMode(in, &mode))
+        return static_cast<bool>(std::getline(std::cin, line));
+
+    std::cout.flush();
+    std::wstring wide;
+    wchar_t buf[512];
+    while (wide.empty() || wide.back() != L'\n') {
+        DWORD got = 0;
+        if (!ReadConsoleW(in, buf, sizeof(buf) / sizeof(buf[0]), &got, nullptr) || got == 0) {
+            if (wide.empty())
+                return false;
+            break;
+        }
+        wide.append(buf, got);
+    }
+    while (!wide.empty() && (wide.back() == L'\n' || wide.back() == L'\r'))
+        wide.pop_back();
+    line = narrow(wide);
+    return true;
+#else
+    std::cout.flush();
+    if (!std::getline(std::cin, line))
+        return false;
+    if (!line.empty() && line.back() == '\r')
+        line.pop_back();
+    return true;
+#endif
+}
+
+static bool block_is_open(const std::string &text) {
+    cmd::Tokenizer tok(text.c_str());
+    tok.tokenize();
+    return tok.open_blocks() > 0;
+}
 
 int shell() {
+#ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
     SetConsoleCP(CP_UTF8);
+#endif
     std::ios_base::sync_with_stdio(false);
     std::setlocale(LC_ALL, ".UTF-8");
 
@@ -22,31 +67,26 @@ int shell() {
               << ". Visit https://www.gnu.org/licenses/gpl-3.0.en.html#license-text.\n";
 
     int last_error_code = 0;
+    std::string input;
 
     while (true) {
-        char cwd[PATH_MAX];
-        DWORD len = GetCurrentDirectoryA(sizeof(cwd), cwd);
-        if (len == 0) {
-            std::cerr << "GetCurrentDirectory failed (error " << GetLastError() << ")\n";
-            return 1;
-        }
+        if (echo_enabled)
+            std::cout << render_prompt();
 
-        // Build the prompt dynamically
-        std::string prompt;
-        if (!custom_prompt.empty()) {
-            prompt = custom_prompt;
-        } else {
-            prompt = std::string(cwd) + ">";
-        }
-        if (!echo_enabled) {
-            prompt = "";
+        if (!read_line(input)) {
+            break;
         }
 
-        std::cout << prompt;
-
-        std::string input;
-        if (!std::getline(std::cin, input)) {
-            break;
+        // A block left open continues on the following lines, which become part of the same
+        // command line.
+        std::string line;
+        while (block_is_open(input)) {
+            if (echo_enabled)
+                std::cout << "More? ";
+            if (!read_line(line))
+                break;
+            input += '\n';
+            input += line;
         }
 
         if (!input.empty()) {
@@ -0,0 +1,290 @@
+#include "tokenizer.hpp"
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENCMD_LEX_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace cmd {
+
+enum CharClass : uint8_t {
+    Ordinary,
+    Space,
+    NewLine,
+    Quote,
+    Caret,
+    Amp,
+    Pipe,
+    Less,
+    Greater,
+    LParen,
+    RParen,
+};
+
+static constexpr std::array<uint8_t, 256> make_char_classes() {
+    std::array<uint8_t, 256> t{};
+    for (unsigned char c : {' ', '\t', '\r', '\v', '\f'})
+        t[c] = Space;
+    t['\n'] = NewLine;
+    t['"'] = Quote;
+    t['^'] = Caret;
+    t['&'] = Amp;
+    t['|'] = Pipe;
+    t['<'] = Less;
+    t['>'] = Greater;
+    t['('] = LParen;
+    t[')'] = RParen;
+    return t;
+}
+
+static constexpr std::array<uint8_t, 256> char_class = make_char_classes();
+
+static inline uint8_t class_of(char c) { return char_class[static_cast<unsigned char>(c)]; }
+
+// Returns the first character in [s, end) that is not Ordinary. The vector loop flags every byte
+// at or below the space character, which includes a few control characters the table treats as
+// ordinary; those are stepped over one at a time.
+static const char *skip_ordinary(const char *s, const char *end) {
+#ifdef OPENCMD_LEX_SSE2
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i specials[] = {_mm_set1_epi8('"'), _mm_set1_epi8('^'), _mm_set1_epi8('&'),
+                                _mm_set1_epi8('|'), _mm_set1_epi8('<'), _mm_set1_epi8('>'),
+                                _mm_set1_epi8('('), _mm_set1_epi8(')')};
+    while (end - s >= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+        __m128i hit = _mm_cmpeq_epi8(_mm_min_epu8(v, space), v);
+        for (const __m128i &special : specials)
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, special));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+        if (!mask) {
+            s += 16;
+            continue;
+        }
+        s += std::countr_zero(mask);
+        if (class_of(*s) != Ordinary)
+            return s;
+        ++s;
+    }
+#endif
+    while (s < end && class_of(*s) == Ordinary)
+        ++s;
+    return s;
+}
+
+static bool iequals(const std::string &a, const char *b) {
+    size_t n = std::strlen(b);
+    if (a.size() != n)
+        return false;
+    for (size_t i = 0; i < n; ++i)
+        if (std::tolower(static_cast<unsigned char>(a[i])) != b[i])
+            return false;
+    return true;
+}
+
+Tokenizer::Tokenizer(const char *s) : p(s ? s : ""), end(p + std::strlen(p)) {}
+
+Token Tokenizer::redirection() {
+    const char *start = p;
+    if (std::isdigit(static_cast<unsigned char>(*p)))
+        ++p;
+    if (*p == '>' && p + 1 < end && p[1] == '>')
+        p += 2;
+    else
+        ++p;
+    // "2>&1" names its target handle; anything else is followed by a file name.
+    redirect_target = true;
+    if (p + 1 < end && *p == '&' && std::isdigit(static_cast<unsigned char>(p[1]))) {
+        p += 2;
+        redirect_target = false;
+    }
+    return {TokenKind::Symbol, std::string(start, p)};
+}
+
+Token Tokenizer::word() {
+    bool is_command = command_pos && !redirect_target;
+    bool is_flag = *p == '/';
+    bool quoted = false;
+    std::string text;
+    bool ended = false;
+    while (!ended && p < end) {
+        char c = *p;
+        switch (class_of(c)) {
+        case Ordinary:
+            if (!is_command) {
+                const char *stop = skip_ordinary(p, end);
+                text.append(p, stop);
+                p = stop;
+            } else if (c == '/' && !text.empty()) {
+                ended = true;
+            } else if ((c == '.' || c == ':') && iequals(text, "echo")) {
+                ++p;
+                echo_rest = true;
+                ended = true;
+            } else {
+                text.push_back(c);
+                ++p;
+            }
+            break;
+        case Quote: {
+            quoted = true;
+            ++p;
+            const char *close = static_cast<const char *>(std::memchr(p, '"', end - p));
+            text.append(p, close ? close : end);
+            p = close ? close + 1 : end;
+            break;
+        }
+        case Caret:
+            ++p;
+            if (p < end)
+                text.push_back(*p++);
+            break;
+        case RParen:
+            if (depth > 0) {
+                ended = true;
+                break;
+            }
+            text.push_back(c);
+            ++p;
+            break;
+        case LParen:
+            if (is_command && iequals(text, "echo")) {
+                ++p;
+                echo_rest = true;
+                ended = true;
+                break;
+            }
+            text.push_back(c);
+            ++p;
+            break;
+        default:
+            ended = true;
+            break;
+        }
+    }
+    if (is_command) {
+        command_pos = false;
+        in_for = iequals(text, "for");
+    } else if (in_for && iequals(text, "in")) {
+        set_follows = true;
+    } else if (in_for && iequals(text, "do")) {
+        command_pos = true;
+        in_for = false;
+    }
+    redirect_target = false;
+    TokenKind kind = quoted ? TokenKind::String : TokenKind::Identifier;
+    if (is_flag && !quoted && !is_command)
+        kind = TokenKind::Flag;
+    return {kind, std::move(text)};
+}
+
+// The text after "echo.", "echo:" or "echo(" is printed as it stands: whitespace and quotes are
+// kept, and only carets and the operators that end a command are interpreted.
+Token Tokenizer::echo_text() {
+    std::string text;
+    bool quoted = false;
+    while (p < end) {
+        char c = *p;
+        uint8_t cls = class_of(c);
+        if (cls == Quote) {
+            quoted = !quoted;
+        } else if (cls == NewLine) {
+            break;
+        } else if (!quoted) {
+            if (cls == Amp || cls == Pipe || cls == Less || cls == Greater ||
+                (cls == RParen && depth > 0))
+                break;
+            if (std::isdigit(static_cast<unsigned char>(c)) && p + 1 < end &&
+                (p[1] == '<' || p[1] == '>'))
+                break;
+            if (cls == Caret) {
+                ++p;
+                if (p < end && class_of(*p) != NewLine)
+                    text.push_back(*p++);
+                continue;
+            }
+        }
+        text.push_back(c);
+        ++p;
+    }
+    return {TokenKind::String, std::move(text)};
+}
+
+Token Tokenizer::next() {
+    if (echo_rest) {
+        echo_rest = false;
+        return echo_text();
+    }
+    while (p < end && (class_of(*p) == Space || (class_of(*p) == NewLine && depth == 0)))
+        ++p;
+    if (p >= end)
+        return {TokenKind::End, ""};
+
+    bool opens_set = set_follows;
+    set_follows = false;
+    switch (class_of(*p)) {
+    case NewLine:
+        // Only reached inside a block, where a line break separates commands like &.
+        ++p;
+        command_pos = true;
+        in_for = false;
+        return {TokenKind::Symbol, "\n"};
+    case Amp:
+    case Pipe: {
+        const char *start = p++;
+        if (p < end && *p == *start)
+            ++p;
+        command_pos = true;
+        in_for = false;
+        return {TokenKind::Symbol, std::string(start, p)};
+    }
+    case Less:
+    case Greater:
+        return redirection();
+    case LParen:
+        if (command_pos || opens_set) {
+            ++p;
+            ++depth;
+            command_pos = !opens_set;
+            return {TokenKind::Symbol, "("};
+        }
+        break;
+    case RParen:
+        if (depth > 0) {
+            ++p;
+            --depth;
+            command_pos = false;
+            return {TokenKind::Symbol, ")"};
+        }
+        break;
+    case Ordinary:
+        if (std::isdigit(static_cast<unsigned char>(*p)) && p + 1 < end &&
+            (p[1] == '<' || p[1] == '>'))
+            return redirection();
+        break;
+    default:
+        break;
+    }
+    Token t = word();
+    // A lone trailing caret leaves an empty word behind; it is not an argument.
+    if (t.kind == TokenKind::Identifier && t.text.empty())
+        return next();
+    return t;
+}
+
+std::vector<Token> Tokenizer::tokenize() {
+    std::vector<Token> out;
+    while (true) {
+        Token t = next();
+        if (t.kind == TokenKind::End)
+            break;
+        out.push_back(std::move(t));
+    }
+    return out;
+}
+
+} // namespace cmd
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace cmd {
+
+enum class TokenKind {
+    Identifier,
+    String,
+    Flag,
+    End,
+    Symbol,
+};
+
+struct Token {
+    TokenKind kind;
+    std::string text;
+};
+
+// Splits an already expanded command line (phase 1, %VAR% substitution, has run) into words and
+// operators in a single pass, following CMD's phase 2 rules:
+//
+//   - Whitespace separates words. A caret escapes the next character; a trailing caret is dropped.
+//   - Double quotes toggle quoting inside a word; special characters are literal while quoted and
+//     the quotes themselves are removed. Words that contained quotes are String tokens.
+//   - & && | || and redirections (< > >> with an optional handle digit and &n target) are Symbol
+//     tokens wherever they appear unquoted.
+//   - ( is a Symbol only where a command may start or where FOR expects its set; ) is a Symbol
+//     only while such a parenthesis is open. Elsewhere both are ordinary characters.
+//   - A line break inside an open parenthesis is a "\n" Symbol that separates commands; outside
+//     one it is whitespace.
+//   - In the command word, / starts a new token ("cd/d" is "cd" "/d"). "echo.", "echo:" and
+//     "echo(" yield "echo" followed by one String token holding the rest of the command as
+//     written, spaces and quotes included; it is empty if nothing follows, so "echo." prints a
+//     blank line, "echo. hi" prints " hi" and "echo.." prints ".".
+//
+// Characters are classified with a 256-entry table, and runs of ordinary characters inside
+// arguments are skipped 16 bytes at a time with SSE2 when it is available.
+class Tokenizer {
+  private:
+    const char *p;
+    const char *end;
+    int depth = 0;
+    bool command_pos = true;
+    bool redirect_target = false;
+    bool in_for = false;
+    bool set_follows = false;
+    bool echo_rest = false;
+
+    Token word();
+    Token echo_text();
+    Token redirection();
+
+  public:
+    explicit Tokenizer(const char *s);
+    Token next();
+    std::vector<Token> tokenize();
+    // Parentheses still open at the current position; after tokenize() a positive value means the
+    // block continues on the next line.
+    int open_blocks() const { return depth; }
+};
+
+} // namespace cmd
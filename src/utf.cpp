@@ -0,0 +1,182 @@
+#include "utf.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+// OPENCMD_UTF_SCALAR leaves out the SSE2 paths, for measuring the scalar loops alone.
+#if !defined(OPENCMD_UTF_SCALAR) &&                                                                \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define OPENCMD_UTF_SSE2 1
+#include <emmintrin.h>
+#endif
+
+static constexpr char16_t replacement_char = 0xFFFD;
+
+static inline bool is_continuation(unsigned char c) { return (c & 0xC0) == 0x80; }
+
+size_t utf8_to_utf16(const char *src, size_t len, char16_t *dst) {
+    const auto *s = reinterpret_cast<const unsigned char *>(src);
+    size_t i = 0;
+    char16_t *out = dst;
+    while (i < len) {
+#ifdef OPENCMD_UTF_SSE2
+        // Widen 16 bytes at a time and keep the ASCII ones in front of the first non-ASCII byte.
+        // Storing all 16 units is safe: out never runs ahead of i. Only tried at an ASCII byte,
+        // since in text made of multi-byte sequences the block would hardly ever be ASCII.
+        while (s[i] < 0x80 && i + 16 <= len) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 8), _mm_unpackhi_epi8(bytes, zero));
+            unsigned high = static_cast<unsigned>(_mm_movemask_epi8(bytes));
+            size_t ascii = high ? std::countr_zero(high) : 16;
+            i += ascii;
+            out += ascii;
+            if (i >= len || high)
+                break;
+        }
+        if (i >= len)
+            break;
+#endif
+        unsigned char c = s[i];
+        if (c < 0x80) {
+            *out++ = c;
+            ++i;
+            continue;
+        }
+
+        // Decode one multi-byte sequence, rejecting overlong forms, surrogates and values past
+        // U+10FFFF. A malformed sequence becomes one U+FFFD covering its longest valid prefix.
+        size_t need;
+        uint32_t cp;
+        unsigned char lo = 0x80, hi = 0xBF;
+        if (c >= 0xC2 && c <= 0xDF) {
+            need = 1;
+            cp = c & 0x1F;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            need = 2;
+            cp = c & 0x0F;
+            if (c == 0xE0)
+                lo = 0xA0;
+            else if (c == 0xED)
+                hi = 0x9F;
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            need = 3;
+            cp = c & 0x07;
+            if (c == 0xF0)
+                lo = 0x90;
+            else if (c == 0xF4)
+                hi = 0x8F;
+        } else {
+            *out++ = replacement_char;
+            ++i;
+            continue;
+        }
+
+        size_t j = 1;
+        for (; j <= need && i + j < len; ++j) {
+            unsigned char cc = s[i + j];
+            if (j == 1 ? (cc < lo || cc > hi) : !is_continuation(cc))
+                break;
+            cp = (cp << 6) | (cc & 0x3F);
+        }
+        if (j <= need) {
+            *out++ = replacement_char;
+            i += j;
+            continue;
+        }
+        i += need + 1;
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            *out++ = static_cast<char16_t>(0xD800 + (cp >> 10));
+            *out++ = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+        } else {
+            *out++ = static_cast<char16_t>(cp);
+        }
+    }
+    return static_cast<size_t>(out - dst);
+}
+
+size_t utf16_to_utf8(const char16_t *src, size_t len, char *dst) {
+    size_t i = 0;
+    auto *out = reinterpret_cast<unsigned char *>(dst);
+    while (i < len) {
+#ifdef OPENCMD_UTF_SSE2
+        // Narrow 16 units at a time and keep the ASCII ones in front of the first non-ASCII unit,
+        // as above. The range check is done on the raw 16-bit values because the saturating pack
+        // treats units >= 0x8000 as negative.
+        while (src[i] < 0x80 && i + 16 <= len) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(a, b));
+            __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+            __m128i zero = _mm_setzero_si128();
+            unsigned ascii_a = static_cast<unsigned>(
+                _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(a, mask), zero)));
+            unsigned ascii_b = static_cast<unsigned>(
+                _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(b, mask), zero)));
+            // Two mask bits per unit.
+            unsigned high = ~(ascii_a | ascii_b << 16);
+            size_t ascii = high ? std::countr_zero(high) / 2 : 16;
+            i += ascii;
+            out += ascii;
+            if (i >= len || high)
+                break;
+        }
+        if (i >= len)
+            break;
+#endif
+        uint32_t cp = src[i++];
+        if (cp < 0x80) {
+            *out++ = static_cast<unsigned char>(cp);
+            continue;
+        }
+        if (cp < 0x800) {
+            *out++ = static_cast<unsigned char>(0xC0 | (cp >> 6));
+            *out++ = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+            continue;
+        }
+        if (cp >= 0xD800 && cp <= 0xDFFF) {
+            if (cp <= 0xDBFF && i < len && src[i] >= 0xDC00 && src[i] <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (src[i++] - 0xDC00);
+                *out++ = static_cast<unsigned char>(0xF0 | (cp >> 18));
+                *out++ = static_cast<unsigned char>(0x80 | ((cp >> 12) & 0x3F));
+                *out++ = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+                continue;
+            }
+            cp = replacement_char;
+        }
+        *out++ = static_cast<unsigned char>(0xE0 | (cp >> 12));
+        *out++ = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+    }
+    return static_cast<size_t>(reinterpret_cast<char *>(out) - dst);
+}
+
+std::u16string utf8_to_utf16(std::string_view s) {
+    std::u16string out(s.size(), u'\0');
+    out.resize(utf8_to_utf16(s.data(), s.size(), out.data()));
+    return out;
+}
+
+std::string utf16_to_utf8(std::u16string_view s) {
+    std::string out(s.size() * 3, '\0');
+    out.resize(utf16_to_utf8(s.data(), s.size(), out.data()));
+    return out;
+}
+
+#ifdef _WIN32
+std::wstring widen(std::string_view s) {
+    std::wstring out(s.size(), L'\0');
+    out.resize(utf8_to_utf16(s.data(), s.size(), reinterpret_cast<char16_t *>(out.data())));
+    return out;
+}
+
+std::string narrow(std::wstring_view s) {
+    std::string out(s.size() * 3, '\0');
+    out.resize(
+        utf16_to_utf8(reinterpret_cast<const char16_t *>(s.data()), s.size(), out.data()));
+    return out;
+}
+#endif
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// OpenCMD keeps every string in UTF-8 internally and converts to UTF-16 only at OS boundaries.
+// These converters never fail: malformed input (bad UTF-8 sequences, lone surrogates) is replaced
+// with U+FFFD. ASCII runs are converted 16 units at a time with SSE2 when it is available.
+//
+// This header and utf.cpp do not depend on <windows.h>, so the transcoder can be built and
+// exercised on any platform.
+
+// Writes the UTF-16 form of [src, src + len) to dst, which must have room for len units, and
+// returns the number of units written.
+size_t utf8_to_utf16(const char *src, size_t len, char16_t *dst);
+
+// Writes the UTF-8 form of [src, src + len) to dst, which must have room for 3 * len bytes, and
+// returns the number of bytes written.
+size_t utf16_to_utf8(const char16_t *src, size_t len, char *dst);
+
+std::u16string utf8_to_utf16(std::string_view s);
+std::string utf16_to_utf8(std::u16string_view s);
+
+#ifdef _WIN32
+static_assert(sizeof(wchar_t) == sizeof(char16_t), "Windows wide strings are UTF-16");
+
+std::wstring widen(std::string_view s);
+std::string narrow(std::wstring_view s);
+#endif
@@ -0,0 +1,393 @@
+#include "where.hpp"
+#include "environment.hpp"
+#include "filesystem.hpp"
+#include "native_io.hpp"
+#include "worker_pool.hpp"
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+static const char *const index_header = "OpenCMD where index 1";
+
+static bool name_less(const std::string &a, const std::string &b) {
+    size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; i < n; ++i) {
+        int ca = std::toupper(static_cast<unsigned char>(a[i]));
+        int cb = std::toupper(static_cast<unsigned char>(b[i]));
+        if (ca != cb)
+            return ca < cb;
+    }
+    return a.size() < b.size();
+}
+
+static std::string fold(const std::string &s) {
+    std::string out = s;
+    for (char &c : out)
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    return out;
+}
+
+static std::string join_path(const std::string &dir, const std::string &name) {
+    if (!dir.empty() && dir.back() == '\\')
+        return dir + name;
+    return dir + '\\' + name;
+}
+
+std::vector<std::string> candidates_for(const std::string &pattern, const std::string &pathext) {
+    std::vector<std::string> out{pattern};
+    if (pattern.find('.') != std::string::npos)
+        return out;
+    size_t start = 0;
+    while (start <= pathext.size()) {
+        size_t end = pathext.find(';', start);
+        if (end == std::string::npos)
+            end = pathext.size();
+        if (end > start)
+            out.push_back(pattern + pathext.substr(start, end - start));
+        start = end + 1;
+    }
+    return out;
+}
+
+// Appends the files of dir that match the candidates, candidate by candidate, so that the order
+// follows PATHEXT and a name matched twice is listed once. names must be sorted by name_less.
+static void match_dir(const std::string &dir, const std::vector<std::string> &names,
+                      const std::vector<std::string> &candidates, std::vector<std::string> &out) {
+    std::vector<bool> taken(names.size());
+    for (const std::string &candidate : candidates) {
+        if (candidate.find_first_of("*?") == std::string::npos) {
+            auto range = std::equal_range(names.begin(), names.end(), candidate, name_less);
+            for (auto it = range.first; it != range.second; ++it) {
+                size_t i = it - names.begin();
+                if (!taken[i])
+                    out.push_back(join_path(dir, names[i]));
+                taken[i] = true;
+            }
+            continue;
+        }
+        for (size_t i = 0; i < names.size(); ++i) {
+            if (taken[i] || !wildcard_match(candidate.c_str(), names[i].c_str()))
+                continue;
+            out.push_back(join_path(dir, names[i]));
+            taken[i] = true;
+        }
+    }
+}
+
+// The file names of one directory as of the scan that produced them.
+struct IndexedDir {
+    std::time_t mtime = 0;
+    std::time_t scanned = 0;
+    std::vector<std::string> names;
+};
+
+using DirNames = std::shared_ptr<const IndexedDir>;
+
+static std::mutex index_mutex;
+static std::map<std::string, DirNames> index_dirs;
+static std::string index_file;
+static bool index_loaded = false;
+static bool index_dirty = false;
+
+static std::string index_location() {
+    std::string path;
+    if (get_env_var("OPENCMD_WHERE_INDEX", path) && !path.empty())
+        return path;
+    if (!get_env_var("LOCALAPPDATA", path) || path.empty())
+        return "";
+    return path + "\\OpenCMD\\where.idx";
+}
+
+static bool read_file(const std::string &path, std::string &out) {
+    NativeHandle h = open_for_reading(path);
+    if (h == no_handle)
+        return false;
+    uint64_t size = 0;
+    bool ok = disk_file_size(h, size) && size < (uint64_t(1) << 30);
+    if (ok)
+        out.resize(static_cast<size_t>(size));
+    size_t done = 0;
+    while (ok && done < out.size()) {
+        size_t got = 0;
+        ok = read_handle(h, out.data() + done, out.size() - done, got) && got > 0;
+        done += got;
+    }
+    close_handle(h);
+    return ok;
+}
+
+static bool next_line(const std::string &text, size_t &pos, std::string &line) {
+    if (pos >= text.size())
+        return false;
+    size_t end = text.find('\n', pos);
+    if (end == std::string::npos)
+        end = text.size();
+    line.assign(text, pos, end - pos);
+    pos = end + 1;
+    return true;
+}
+
+// The file holds the header line, then for each directory a line "mtime scanned count path"
+// followed by its count file names, one per line.
+static bool parse_index(const std::string &text, std::map<std::string, DirNames> &out) {
+    size_t pos = 0;
+    std::string line;
+    if (!next_line(text, pos, line) || line != index_header)
+        return false;
+    while (next_line(text, pos, line)) {
+        auto dir = std::make_shared<IndexedDir>();
+        char *end = nullptr;
+        dir->mtime = static_cast<std::time_t>(std::strtoll(line.c_str(), &end, 10));
+        dir->scanned = static_cast<std::time_t>(std::strtoll(end, &end, 10));
+        unsigned long count = std::strtoul(end, &end, 10);
+        if (*end != ' ')
+            return false;
+        std::string path = end + 1;
+        // The count comes from the file, so it only hints at the size.
+        dir->names.reserve(std::min<unsigned long>(count, 4096));
+        for (unsigned long i = 0; i < count; ++i) {
+            if (!next_line(text, pos, line))
+                return false;
+            dir->names.push_back(line);
+        }
+        out[fold(path)] = std::move(dir);
+    }
+    return true;
+}
+
+static std::string format_index(const std::map<std::string, DirNames> &dirs) {
+    std::string out = index_header;
+    out += '\n';
+    for (const auto &[path, dir] : dirs) {
+        out += std::to_string(static_cast<long long>(dir->mtime)) + ' ' +
+               std::to_string(static_cast<long long>(dir->scanned)) + ' ' +
+               std::to_string(dir->names.size()) + ' ' + path + '\n';
+        for (const std::string &name : dir->names) {
+            out += name;
+            out += '\n';
+        }
+    }
+    return out;
+}
+
+// Called with index_mutex held. A different OPENCMD_WHERE_INDEX starts over from that file.
+static void load_index() {
+    std::string location = index_location();
+    if (index_loaded && location == index_file)
+        return;
+    index_dirs.clear();
+    index_file = location;
+    index_loaded = true;
+    index_dirty = false;
+    std::string text;
+    if (!location.empty() && read_file(location, text) && !parse_index(text, index_dirs))
+        index_dirs.clear();
+}
+
+// Writes the index if this search changed it. Only the directories of this search are kept, so
+// directories that left PATH do not pile up in the file. Entries another shell saved for them in
+// the meantime are merged in when they are newer than ours, then the file is replaced in one step.
+static void save_index(const std::vector<std::string> &dirs) {
+    std::set<std::string> wanted;
+    for (const std::string &dir : dirs)
+        wanted.insert(fold(dir));
+    std::lock_guard<std::mutex> lock(index_mutex);
+    for (auto it = index_dirs.begin(); it != index_dirs.end();) {
+        if (wanted.count(it->first)) {
+            ++it;
+        } else {
+            it = index_dirs.erase(it);
+            index_dirty = true;
+        }
+    }
+    if (!index_dirty || index_file.empty())
+        return;
+    index_dirty = false;
+    std::string text;
+    std::map<std::string, DirNames> on_disk;
+    if (read_file(index_file, text) && parse_index(text, on_disk)) {
+        for (auto &[path, dir] : on_disk) {
+            if (!wanted.count(path))
+                continue;
+            DirNames &mine = index_dirs[path];
+            if (!mine || mine->scanned < dir->scanned)
+                mine = std::move(dir);
+        }
+    }
+    text = format_index(index_dirs);
+
+    size_t slash = index_file.find_last_of('\\');
+    if (slash != std::string::npos)
+        create_directory(index_file.substr(0, slash));
+    std::string temp = index_file + '.' + std::to_string(process_id());
+    bool denied = false;
+    NativeHandle h = open_for_writing(temp, false, denied);
+    if (h == no_handle)
+        return;
+    bool ok = write_handle(h, text.data(), text.size());
+    close_handle(h);
+    if (!ok || !replace_file(temp, index_file))
+        delete_file(temp);
+}
+
+// The names in dir, from the index if its entry is still current or from a fresh listing that
+// then replaces the entry. Null if dir is not a directory.
+static DirNames dir_names(const std::string &dir) {
+    FileEntry info;
+    if (!file_system().stat(dir, info) || !info.is_dir)
+        return nullptr;
+    std::string key = fold(dir);
+    {
+        std::lock_guard<std::mutex> lock(index_mutex);
+        auto it = index_dirs.find(key);
+        if (it != index_dirs.end() && it->second->mtime == info.mtime &&
+            it->second->mtime < it->second->scanned)
+            return it->second;
+    }
+    auto fresh = std::make_shared<IndexedDir>();
+    fresh->mtime = info.mtime;
+    fresh->scanned = std::time(nullptr);
+    file_system().list_dir(dir, [&](const FileEntry &entry) {
+        if (!entry.is_dir)
+            fresh->names.push_back(entry.name);
+    });
+    std::sort(fresh->names.begin(), fresh->names.end(), name_less);
+    std::lock_guard<std::mutex> lock(index_mutex);
+    index_dirs[key] = fresh;
+    index_dirty = true;
+    return fresh;
+}
+
+std::vector<std::string> search_dirs(const std::string &current_dir, const std::string &path) {
+    std::vector<std::string> dirs;
+    std::set<std::string> seen;
+    auto add = [&](std::string dir) {
+        dir.erase(std::remove(dir.begin(), dir.end(), '"'), dir.end());
+        while (dir.size() > 3 && dir.back() == '\\')
+            dir.pop_back();
+        if (!dir.empty() && seen.insert(fold(dir)).second)
+            dirs.push_back(std::move(dir));
+    };
+    add(current_dir);
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = path.find(';', start);
+        if (end == std::string::npos)
+            end = path.size();
+        add(path.substr(start, end - start));
+        start = end + 1;
+    }
+    return dirs;
+}
+
+struct WalkedDir {
+    std::string path;
+    std::vector<std::vector<std::string>> matches;
+};
+
+// Walks the tree under root with a pool of threads taking directories from a shared stack. A
+// thread lists a directory without holding the lock, then pushes its subdirectories and records
+// its matches. The walk ends when the stack is empty and no thread is listing. Links to directories
+// are not followed, so a link back up the tree cannot send the walk round in circles.
+static void walk_tree(const std::string &root,
+                      const std::vector<std::vector<std::string>> &candidates, unsigned jobs,
+                      std::vector<std::vector<std::string>> &matches) {
+    std::mutex lock;
+    std::condition_variable wake;
+    std::vector<std::string> pending{root};
+    std::vector<WalkedDir> walked;
+    unsigned busy = 0;
+
+    auto worker = [&] {
+        std::unique_lock<std::mutex> guard(lock);
+        while (true) {
+            wake.wait(guard, [&] { return !pending.empty() || busy == 0; });
+            if (pending.empty())
+                return;
+            std::string dir = std::move(pending.back());
+            pending.pop_back();
+            ++busy;
+            guard.unlock();
+
+            std::vector<std::string> subdirs, names;
+            file_system().scan_dir(dir, [&](const FileEntry &entry) {
+                if (!entry.is_dir)
+                    names.push_back(entry.name);
+                else if (!entry.is_link)
+                    subdirs.push_back(entry.name);
+            });
+            std::sort(names.begin(), names.end(), name_less);
+            WalkedDir result{dir, std::vector<std::vector<std::string>>(candidates.size())};
+            bool any = false;
+            for (size_t p = 0; p < candidates.size(); ++p) {
+                match_dir(dir, names, candidates[p], result.matches[p]);
+                any = any || !result.matches[p].empty();
+            }
+
+            guard.lock();
+            for (const std::string &sub : subdirs)
+                pending.push_back(join_path(dir, sub));
+            if (any)
+                walked.push_back(std::move(result));
+            --busy;
+            wake.notify_all();
+        }
+    };
+
+    if (jobs == 0)
+        jobs = WorkerPool::default_jobs();
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < jobs; ++t)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &t : threads)
+        t.join();
+
+    std::sort(walked.begin(), walked.end(),
+              [](const WalkedDir &a, const WalkedDir &b) { return name_less(a.path, b.path); });
+    for (WalkedDir &dir : walked)
+        for (size_t p = 0; p < matches.size(); ++p)
+            for (std::string &path : dir.matches[p])
+                matches[p].push_back(std::move(path));
+}
+
+bool where_search(const std::vector<std::string> &patterns, const WhereOptions &options,
+                  std::vector<std::vector<std::string>> &matches, std::string &error) {
+    std::vector<std::vector<std::string>> candidates;
+    for (const std::string &pattern : patterns)
+        candidates.push_back(candidates_for(pattern, options.pathext));
+    matches.assign(patterns.size(), {});
+
+    if (!options.root.empty()) {
+        if (!file_system().is_directory(options.root)) {
+            error = "The system cannot find the path specified.";
+            return false;
+        }
+        walk_tree(options.root, candidates, options.jobs, matches);
+        return true;
+    }
+
+    std::vector<std::string> dirs = search_dirs(options.current_dir, options.path);
+    {
+        std::lock_guard<std::mutex> lock(index_mutex);
+        load_index();
+    }
+    std::vector<DirNames> listings(dirs.size());
+    {
+        WorkerPool pool(options.jobs, dirs.size(),
+                        [&](size_t i) { listings[i] = dir_names(dirs[i]); });
+    }
+    for (size_t p = 0; p < patterns.size(); ++p)
+        for (size_t d = 0; d < dirs.size(); ++d)
+            if (listings[d])
+                match_dir(dirs[d], listings[d]->names, candidates[p], matches[p]);
+    save_index(dirs);
+    return true;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+struct WhereOptions {
+    // /R: walk the tree under this directory instead of searching PATH.
+    std::string root;
+    // Searched first, then each directory on path in order.
+    std::string current_dir;
+    std::string path;
+    // A pattern without an extension also matches itself with each of these appended.
+    std::string pathext = ".COM;.EXE;.BAT;.CMD";
+    // Threads that scan directories, 0 for one per processor.
+    unsigned jobs = 0;
+};
+
+// Finds the files matching each pattern (wildcards allowed) and fills matches with one list of
+// full paths per pattern, in the order WHERE prints them.
+//
+// A PATH search stats every directory in parallel and takes the file names from an index rather
+// than listing the directory again. The index is kept in memory and in a file shared by all
+// shells (OPENCMD_WHERE_INDEX, or %LOCALAPPDATA%\OpenCMD\where.idx), and an entry is used only
+// while the directory's modification time is the one it was built with. Entries built in the
+// same second as the directory last changed are not trusted, since a later change in that second
+// would leave the time as it was. The index holds the directories of the latest search only. A
+// /R search has no index; its tree is walked by several threads sharing a queue of directories.
+//
+// Returns false with a message in error if the /R root is not a directory.
+bool where_search(const std::vector<std::string> &patterns, const WhereOptions &options,
+                  std::vector<std::vector<std::string>> &matches, std::string &error);
+
+// The directories a command is looked for in, in order: current_dir, then each entry of the
+// ';'-separated path, without quotes, trailing separators or repeats.
+std::vector<std::string> search_dirs(const std::string &current_dir, const std::string &path);
+
+// The names to try for a pattern: the pattern itself, then, if it has no extension, the pattern
+// with each PATHEXT extension, so that "python" finds python.exe.
+std::vector<std::string> candidates_for(const std::string &pattern, const std::string &pathext);
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+// A bounded set of threads that each claim the next unprocessed index in [0, count) and run the
+// job on it. Indices are claimed in increasing order, so earlier items always start first and a
+// pool with one worker behaves like a plain loop.
+class WorkerPool {
+  private:
+    std::atomic<size_t> next{0};
+    size_t count;
+    std::function<void(size_t)> job;
+    std::vector<std::thread> threads;
+
+    void work() {
+        for (size_t i = next++; i < count; i = next++)
+            job(i);
+    }
+
+  public:
+    WorkerPool(unsigned jobs, size_t n, std::function<void(size_t)> fn)
+        : count(n), job(std::move(fn)) {
+        if (jobs == 0)
+            jobs = default_jobs();
+        if (jobs > count)
+            jobs = static_cast<unsigned>(count);
+        threads.reserve(jobs);
+        for (unsigned t = 0; t < jobs; ++t)
+            threads.emplace_back([this] { work(); });
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    ~WorkerPool() { wait(); }
+
+    void wait() {
+        for (auto &t : threads)
+            if (t.joinable())
+                t.join();
+    }
+
+    static unsigned default_jobs() {
+        unsigned n = std::thread::hardware_concurrency();
+        return n ? n : 1;
+    }
+};
@@ -0,0 +1,105 @@
+// How the lexer splits command lines: ECHO's attached text forms, quoting and carets, operators,
+// and which parentheses open a block. Runs on any platform; exits non-zero if a check fails.
+
+#include "../src/tokenizer.hpp"
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+using cmd::Token;
+using cmd::TokenKind;
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+static std::vector<Token> lex(const char *line) {
+    cmd::Tokenizer tok(line);
+    return tok.tokenize();
+}
+
+static bool texts_are(const char *line, std::initializer_list<const char *> expected) {
+    std::vector<Token> tokens = lex(line);
+    if (tokens.size() != expected.size())
+        return false;
+    size_t i = 0;
+    for (const char *text : expected)
+        if (tokens[i++].text != text)
+            return false;
+    return true;
+}
+
+static void test_echo_text() {
+    check(texts_are("echo.", {"echo", ""}), "echo. gives an empty text");
+    check(texts_are("echo. hello", {"echo", " hello"}), "echo. keeps the leading space");
+    check(texts_are("echo..", {"echo", "."}), "echo.. gives a dot");
+    check(texts_are("echo:", {"echo", ""}), "echo: gives an empty text");
+    check(texts_are("echo:foo bar", {"echo", "foo bar"}), "echo: keeps the rest as one word");
+    check(texts_are("echo(", {"echo", ""}), "echo( gives an empty text");
+    check(texts_are("echo(x  y", {"echo", "x  y"}), "echo( keeps inner spacing");
+    check(texts_are("ECHO.Hi", {"ECHO", "Hi"}), "echo. is matched without regard to case");
+    check(lex("echo.x")[1].kind == TokenKind::String, "echo text is a String token");
+    check(texts_are("echo \"a  b\"", {"echo", "a  b"}), "plain echo keeps word rules");
+}
+
+static void test_echo_text_ends() {
+    check(texts_are("echo.a & echo b", {"echo", "a ", "&", "echo", "b"}),
+          "echo text ends at an operator");
+    check(texts_are("echo.a^&b", {"echo", "a&b"}), "a caret escapes an operator");
+    check(texts_are("echo.\"a & b\"", {"echo", "\"a & b\""}), "quotes are kept and protect");
+    check(texts_are("echo.x>out", {"echo", "x", ">", "out"}), "echo text ends at a redirection");
+    check(texts_are("echo.x 2>nul", {"echo", "x ", "2>", "nul"}),
+          "a handle digit starts a redirection");
+    check(texts_are("(echo(x)", {"(", "echo", "x", ")"}), "a block's parenthesis ends the text");
+    check(texts_are("echo.(x)", {"echo", "(x)"}), "outside a block parentheses are text");
+    cmd::Tokenizer open("echo(");
+    open.tokenize();
+    check(open.open_blocks() == 0, "echo( does not open a block");
+}
+
+static void test_words() {
+    check(texts_are("cd/d c:\\", {"cd", "/d", "c:\\"}), "a slash splits the command word");
+    check(lex("dir /b")[1].kind == TokenKind::Flag, "an argument slash is a flag");
+    check(texts_are("echo a^ b", {"echo", "a b"}), "a caret escapes a space");
+    check(texts_are("echo a^", {"echo", "a"}), "a trailing caret is dropped");
+    check(texts_are("a&&b||c|d", {"a", "&&", "b", "||", "c", "|", "d"}), "operators split words");
+    check(texts_are("sort < in 2>&1", {"sort", "<", "in", "2>&1"}), "redirections");
+}
+
+static void test_blocks() {
+    check(texts_are("(a\nb)", {"(", "a", "\n", "b", ")"}), "a line break in a block separates");
+    check(texts_are("a\nb", {"a", "b"}), "a line break outside a block is a space");
+    check(texts_are("for %a in (1 2) do (echo %a)",
+                    {"for", "%a", "in", "(", "1", "2", ")", "do", "(", "echo", "%a", ")"}),
+          "FOR set and body");
+    check(texts_are("echo f(x)", {"echo", "f(x)"}), "parentheses inside arguments");
+    cmd::Tokenizer open("if (a");
+    open.tokenize();
+    check(open.open_blocks() == 0, "an argument parenthesis opens no block");
+    cmd::Tokenizer block("(echo a");
+    block.tokenize();
+    check(block.open_blocks() == 1, "an unclosed block continues");
+}
+
+static void test_long_line() {
+    std::string line = "echo " + std::string(8000, 'x') + " & echo y";
+    check(texts_are(line.c_str(), {"echo", std::string(8000, 'x').c_str(), "&", "echo", "y"}),
+          "a long argument spans the vector loop");
+}
+
+int main() {
+    test_echo_text();
+    test_echo_text_ends();
+    test_words();
+    test_blocks();
+    test_long_line();
+    if (failures == 0)
+        std::printf("test_tokenizer: all checks passed\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+// Round trips through the UTF-8 <-> UTF-16 transcoder, and how it replaces malformed, truncated
+// and unpaired-surrogate input. Runs on any platform; exits non-zero if a check fails.
+
+#include "../src/utf.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    if (!ok) {
+        std::printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+static std::u16string units(std::initializer_list<char16_t> list) { return std::u16string(list); }
+
+// Pads s with ASCII in front so its interesting part straddles the 16-unit SIMD blocks.
+template <typename String> static String after_ascii(const String &s, size_t ascii) {
+    String out(ascii, 'a');
+    return out + s;
+}
+
+static void test_ascii() {
+    for (size_t n = 0; n < 70; ++n) {
+        std::string text;
+        for (size_t i = 0; i < n; ++i)
+            text += static_cast<char>(0x20 + i % 95);
+        std::u16string wide = utf8_to_utf16(text);
+        check(wide.size() == n, "ASCII keeps one unit per byte");
+        check(std::u16string(text.begin(), text.end()) == wide, "ASCII widens byte by byte");
+        check(utf16_to_utf8(wide) == text, "ASCII round trip");
+    }
+}
+
+static void test_valid_sequences() {
+    // U+00E9, U+2713 and U+1D11E: two, three and four bytes.
+    std::string text = "h\xC3\xA9llo \xE2\x9C\x93 \xF0\x9D\x84\x9E";
+    std::u16string expected =
+        units({'h', 0xE9, 'l', 'l', 'o', ' ', 0x2713, ' ', 0xD834, 0xDD1E});
+    check(utf8_to_utf16(text) == expected, "multi-byte sequences decode");
+    for (size_t pad = 0; pad < 34; ++pad) {
+        std::string padded = after_ascii(text, pad);
+        check(utf16_to_utf8(utf8_to_utf16(padded)) == padded, "mixed text round trip");
+    }
+}
+
+// Every scalar value survives UTF-16 -> UTF-8 -> UTF-16.
+static void test_all_code_points() {
+    bool ok = true;
+    for (uint32_t cp = 0; cp <= 0x10FFFF && ok; ++cp) {
+        if (cp >= 0xD800 && cp <= 0xDFFF)
+            continue;
+        std::u16string wide;
+        if (cp >= 0x10000) {
+            wide += static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10));
+            wide += static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+        } else {
+            wide += static_cast<char16_t>(cp);
+        }
+        ok = utf8_to_utf16(utf16_to_utf8(wide)) == wide;
+    }
+    check(ok, "every code point round trips");
+}
+
+static void test_malformed_utf8() {
+    const char16_t r = 0xFFFD;
+    check(utf8_to_utf16("a\x80z") == units({'a', r, 'z'}), "lone continuation byte");
+    check(utf8_to_utf16("\xC0\xAF") == units({r, r}), "overlong two-byte form");
+    check(utf8_to_utf16("\xE0\x80\x80") == units({r, r, r}), "overlong three-byte form");
+    check(utf8_to_utf16("\xED\xA0\x80") == units({r, r, r}), "encoded surrogate");
+    check(utf8_to_utf16("\xF4\x90\x80\x80") == units({r, r, r, r}), "past U+10FFFF");
+    check(utf8_to_utf16("\xF5z") == units({r, 'z'}), "invalid lead byte");
+    check(utf8_to_utf16("\xE2\x9C" "a") == units({r, 'a'}), "interrupted sequence");
+}
+
+static void test_truncated_utf8() {
+    const char16_t r = 0xFFFD;
+    check(utf8_to_utf16("a\xE2\x9C") == units({'a', r}), "truncated three-byte sequence");
+    check(utf8_to_utf16("\xF0\x9D\x84") == units({r}), "truncated four-byte sequence");
+    check(utf8_to_utf16("\xC3") == units({r}), "lone lead byte at the end");
+    for (size_t pad = 0; pad < 34; ++pad) {
+        std::u16string expected = after_ascii(units({r}), pad);
+        check(utf8_to_utf16(after_ascii(std::string("\xF0\x9D"), pad)) == expected,
+              "truncation after an ASCII run");
+    }
+}
+
+static void test_surrogates() {
+    const std::string r = "\xEF\xBF\xBD";
+    check(utf16_to_utf8(units({0xD800, 'a'})) == r + "a", "high surrogate without a low one");
+    check(utf16_to_utf8(units({0xDC00, 'a'})) == r + "a", "low surrogate on its own");
+    check(utf16_to_utf8(units({'a', 0xD83D})) == "a" + r, "high surrogate at the end");
+    check(utf16_to_utf8(units({0xDBFF, 0xDFFF})) == "\xF4\x8F\xBF\xBF", "highest pair");
+    for (size_t pad = 0; pad < 34; ++pad)
+        check(utf16_to_utf8(after_ascii(units({0xDC00}), pad)) == std::string(pad, 'a') + r,
+              "lone surrogate after an ASCII run");
+}
+
+// Whatever the input, decoding stays within the documented output sizes and yields UTF-16 that
+// encodes and decodes back to itself.
+static void test_random_bytes() {
+    uint32_t state = 12345;
+    bool ok = true;
+    for (int round = 0; round < 2000 && ok; ++round) {
+        std::string bytes;
+        size_t len = round % 97;
+        for (size_t i = 0; i < len; ++i) {
+            state = state * 1664525u + 1013904223u;
+            unsigned char c = static_cast<unsigned char>(state >> 24);
+            // Every third string is ASCII only, so the SIMD blocks are exercised too.
+            bytes += static_cast<char>(round % 3 == 0 ? c & 0x7F : c);
+        }
+        std::u16string wide = utf8_to_utf16(bytes);
+        std::string narrow = utf16_to_utf8(wide);
+        ok = wide.size() <= bytes.size() && narrow.size() <= 3 * wide.size() &&
+             utf8_to_utf16(narrow) == wide;
+    }
+    check(ok, "random bytes decode to well-formed UTF-16");
+}
+
+int main() {
+    test_ascii();
+    test_valid_sequences();
+    test_all_code_points();
+    test_malformed_utf8();
+    test_truncated_utf8();
+    test_surrogates();
+    test_random_bytes();
+    if (failures == 0)
+        std::printf("test_utf: all checks passed\n");
+    return failures == 0 ? 0 : 1;
+}